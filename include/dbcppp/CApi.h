@@ -172,6 +172,8 @@ extern "C"
     DBCPPP_API const dbcppp_Signal* dbcppp_MessageGetSignalByName(const dbcppp_Message* msg, const char* name);
     DBCPPP_API const dbcppp_Signal* dbcppp_MessageFindSignal(const dbcppp_Message* msg, bool(*pred)(const dbcppp_Signal*, void*), void* data);
     DBCPPP_API void dbcppp_MessageForEachSignal(const dbcppp_Message* msg, void(*cb)(const dbcppp_Signal*, void*), void* data);
+    DBCPPP_API const dbcppp_Signal* dbcppp_MessageGetSignalByIndex(const dbcppp_Message* msg, uint64_t index);
+    DBCPPP_API uint64_t dbcppp_MessageSignalCount(const dbcppp_Message* msg);
     DBCPPP_API const dbcppp_Attribute* dbcppp_MessageGetAttributeValueByName(const dbcppp_Message* msg, const char* name);
     DBCPPP_API const dbcppp_Attribute* dbcppp_MessageFindAttributeValue(dbcppp_Message* msg, bool(*pred)(const dbcppp_Attribute*, void*), void* data);
     DBCPPP_API void dbcppp_MessageForEachAttributeValue(dbcppp_Message* msg, void(*cb)(const dbcppp_Attribute*, void*), void* data);
@@ -203,6 +205,8 @@ extern "C"
     DBCPPP_API const dbcppp_Message* dbcppp_NetworkGetMessageById(const dbcppp_Network* net, uint64_t id);
     DBCPPP_API const dbcppp_Message* dbcppp_NetworkFindMessage(const dbcppp_Network* net, bool(*pred)(const dbcppp_Message*, void*), void* data);
     DBCPPP_API void dbcppp_NetworkForEachMessage(const dbcppp_Network* net, void(*cb)(const dbcppp_Message*));
+    DBCPPP_API const dbcppp_Signal* dbcppp_NetworkGetSignalByGlobalIndex(const dbcppp_Network* net, uint64_t index);
+    DBCPPP_API uint64_t dbcppp_NetworkSignalCount(const dbcppp_Network* net);
     DBCPPP_API const dbcppp_EnvironmentVariable* dbcppp_NetworkGetEnvironmentVariableByName(const dbcppp_Network* net, const char* name);
     DBCPPP_API dbcppp_EnvironmentVariable* dbcppp_NetworkFindEnvironmentVariable(const dbcppp_Network* net, bool(*pred)(const dbcppp_EnvironmentVariable*, void*), void* data);
     DBCPPP_API void dbcppp_NetworkForEachEnvironmentVariable(const dbcppp_Network* net, void(*cb)(const dbcppp_EnvironmentVariable*, void*), void* data);
@@ -260,6 +264,8 @@ extern "C"
     DBCPPP_API void dbcppp_SignalForEachReceiver(const dbcppp_Signal* sig, void(*cb)(const char*, void*), void* data);
     DBCPPP_API const char* dbcppp_SignalGetValueDescriptionByValue(const dbcppp_Signal* signal, int64_t value);
     DBCPPP_API void dbcppp_SignalForEachValueDescription(const dbcppp_Signal* sig, void(*cb)(int64_t, const char*, void*), void* data);
+    DBCPPP_API void dbcppp_SignalGetValueDescriptionIds(const dbcppp_Signal* sig, const uint64_t* raws, uint64_t n, uint32_t* ids);
+    DBCPPP_API const char* dbcppp_SignalGetValueDescriptionById(const dbcppp_Signal* sig, uint32_t id);
     DBCPPP_API const dbcppp_Attribute* dbcppp_SignalGetAttributeValueByName(const dbcppp_Signal* sig, const char* name);
     DBCPPP_API const dbcppp_Attribute* dbcppp_SignalFindAttributeValue(const dbcppp_Signal* sig, bool(*pred)(const dbcppp_Attribute*, void*), void* data);
     DBCPPP_API void dbcppp_SignalForEachAttributeValue(const dbcppp_Signal* sig, void(*cb)(const dbcppp_Attribute*, void*), void* data);
@@ -268,7 +274,12 @@ extern "C"
     DBCPPP_API uint64_t dbcppp_SignalDecode(const dbcppp_Signal* sig, const void* bytes);
     DBCPPP_API void dbcppp_SignalEncode(const dbcppp_Signal* sig, uint64_t raw, void* buffer);
     DBCPPP_API double dbcppp_SignalRawToPhys(const dbcppp_Signal* sig, uint64_t raw);
+    DBCPPP_API float dbcppp_SignalRawToPhysFloat(const dbcppp_Signal* sig, uint64_t raw);
     DBCPPP_API uint64_t dbcppp_SignalPhysToRaw(const dbcppp_Signal* sig, double phys);
+    DBCPPP_API uint64_t dbcppp_SignalGetIndex(const dbcppp_Signal* sig);
+    DBCPPP_API uint64_t dbcppp_SignalGetGlobalIndex(const dbcppp_Signal* sig);
+    DBCPPP_API int32_t dbcppp_SignalGetDecimalScale(const dbcppp_Signal* sig);
+    DBCPPP_API bool dbcppp_SignalRawToDecimal(const dbcppp_Signal* sig, uint64_t raw, int32_t scale, int64_t* mantissa);
 
     DBCPPP_API const dbcppp_SignalType* dbcppp_SignalTypeCreate(
           const char* name
@@ -0,0 +1,26 @@
+
+#pragma once
+
+#include <cstdint>
+
+namespace dbcppp
+{
+    /// \brief A raw CAN/CAN FD frame as received from a bus or read from a log file
+    ///
+    /// The first 72 bytes are layout compatible with the Linux `struct canfd_frame`,
+    /// so frames can be received from the kernel directly into an array of this struct.
+    /// !!! Note: The id of extended frames has bit 31 set, like extended ids are stored in DBC files. !!!
+    struct Frame
+    {
+        uint32_t id;
+        uint8_t size;
+        uint8_t flags;
+        uint8_t reserved0;
+        uint8_t reserved1;
+        alignas(8) uint8_t data[64];
+        /// index of the bus the frame was received on
+        uint32_t bus;
+        /// nanoseconds since epoch, 0 if unknown
+        uint64_t timestamp;
+    };
+}
@@ -0,0 +1,51 @@
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "Export.h"
+#include "Frame.h"
+
+namespace dbcppp
+{
+    /// \brief Reads frames from a candump log file
+    ///
+    /// Supports the default candump output (optionally prefixed by a "(<seconds>.<fraction>)" timestamp)
+    /// and the candump log format ("(<seconds>.<fraction>) <bus> <id>#<data>").
+    /// The file is read in large chunks which are parsed in place. gzip and zstd compressed files are
+    /// detected by their magic number and decompressed on a separate thread while the frames are parsed
+    /// (if dbcppp was built with zlib/zstd).
+    class DBCPPP_API FrameSource
+    {
+    public:
+        enum class Backend
+        {
+            Read, IoUring
+        };
+        enum class Compression
+        {
+            None, Gzip, Zstd
+        };
+
+        /// \brief Opens a candump log file
+        ///
+        /// @param filename name of the log file, "-" for stdin
+        /// @param backend Backend::IoUring keeps several reads in flight using io_uring and falls back
+        ///                to Backend::Read if io_uring is not available or the file is not a regular file
+        /// @return nullptr if the file couldn't be opened
+        static std::unique_ptr<FrameSource> create(const std::string& filename, Backend backend = Backend::IoUring);
+
+        virtual ~FrameSource() = default;
+        virtual Backend getBackend() const = 0;
+        virtual Compression getCompression() const = 0;
+        /// \brief Parses up to n frames, lines which can't be parsed are skipped
+        ///
+        /// @return number of frames written to frames, 0 at end of file
+        virtual std::size_t read(Frame* frames, std::size_t n) = 0;
+        /// \brief Returns the name of the bus a Frame::bus value refers to
+        virtual const std::string& getBusName(uint32_t bus) const = 0;
+    };
+}
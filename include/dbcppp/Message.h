@@ -6,6 +6,7 @@
 #include <memory>
 
 #include "Export.h"
+#include "Range.h"
 #include "Node.h"
 #include "Signal.h"
 #include "Attribute.h"
@@ -21,6 +22,15 @@ namespace dbcppp
             NoError,
             MuxValeWithoutMuxSignal
         };
+        /// \brief The bits of the message a signal depends on
+        ///
+        /// Bit i of words[w] stands for bit i % 8 of byte 8 * w + i / 8, that is the message read as
+        /// little endian 64 bit words. Multiplexed signals also cover the bits of the multiplexer switch
+        /// signal, since it decides whether they are active.
+        struct Coverage
+        {
+            uint64_t words[8];
+        };
 
         static std::unique_ptr<Message> create(
               uint64_t id
@@ -44,11 +54,25 @@ namespace dbcppp
         virtual const Signal* getSignalByName(const std::string& name) const = 0;
         virtual const Signal* findSignal(std::function<bool(const Signal&)>&& pred) const = 0;
         virtual void forEachSignal(std::function<void(const Signal&)>&& cb) const = 0;
+        // same signals in the same order as forEachSignal
+        virtual Range<Signal> signals() const = 0;
+        // index is Signal::getIndex, nullptr if index >= signalCount()
+        virtual const Signal* getSignalByIndex(std::size_t index) const = 0;
+        virtual std::size_t signalCount() const = 0;
+        // index is Signal::getIndex, nullptr if index >= signalCount()
+        virtual const Coverage* getSignalCoverage(std::size_t index) const = 0;
         virtual const Attribute* getAttributeValueByName(const std::string& name) const = 0;
         virtual const Attribute* findAttributeValue(std::function<bool(const Attribute&)>&& pred) const = 0;
         virtual void forEachAttributeValue(std::function<void(const Attribute&)>&& cb) const = 0;
         virtual const std::string& getComment() const = 0;
         virtual const Signal* getMuxSignal() const = 0;
+        // decodes all signals, values[i] receives the physical value of the signal with index i,
+        // multiplexed signals which aren't active keep their value
+        // uses the function compiled by Network::jitCompile if there is one, otherwise Signal::decode/rawToPhys
+        virtual void decodeAll(const void* bytes, double* values) const = 0;
+        // like decodeAll with Signal::rawToPhysFloat, half the output bytes for columnar buffers
+        virtual void decodeAll(const void* bytes, float* values) const = 0;
+        virtual bool isJitCompiled() const = 0;
 
         virtual ErrorCode getError() const = 0;
     };
@@ -0,0 +1,50 @@
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "Export.h"
+#include "Frame.h"
+#include "Network.h"
+
+namespace dbcppp
+{
+    /// \brief Decodes a stream of frames and yields only the signals which changed
+    ///
+    /// The decoder keeps the previous frame of each (bus, id). An incoming frame is XORed with it and only
+    /// the active signals whose Message::Coverage intersects the changed bits are decoded, so a frame which
+    /// repeats unchanged costs one comparison. The first frame of a (bus, id) and frames whose size differs
+    /// from their predecessor yield all active signals. The decoder is not thread safe, the networks are only
+    /// read and must not be modified while the decoder is in use.
+    class DBCPPP_API MessageDecoder
+    {
+    public:
+        struct Value
+        {
+            uint64_t timestamp;
+            uint32_t bus;
+            const Message* message;
+            const Signal* signal;
+            Signal::raw_t raw;
+            double phys;
+        };
+        /// \brief Called with the changed values in frame order
+        using callback_t = std::function<void(const Value* values, std::size_t n)>;
+
+        /// @param networks networks[i] is used to decode the frames with Frame::bus == i,
+        ///                 frames of buses without network are ignored
+        static std::unique_ptr<MessageDecoder> create(std::vector<const Network*> networks);
+
+        virtual ~MessageDecoder() = default;
+        /// \brief Decodes the frames in order and calls cb once with the values of the changed signals
+        ///
+        /// cb isn't called if nothing changed. The value buffer passed to cb is reused by the next call.
+        virtual void decode(const Frame* frames, std::size_t n, const callback_t& cb) = 0;
+        /// \brief Forgets all previous frames, the next frame of each (bus, id) yields all active signals again
+        virtual void reset() = 0;
+    };
+}
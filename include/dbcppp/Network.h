@@ -59,6 +59,16 @@ namespace dbcppp
         virtual const Message* getMessageById(uint64_t id) const = 0;
         virtual const Message* findMessage(std::function<bool(const Message&)>&& pred) const = 0;
         virtual void forEachMessage(std::function<void(const Message&)>&& cb) const = 0;
+        // same messages in the same order (by id) as forEachMessage, invalidated by merge
+        virtual Range<Message> messages() const = 0;
+        // index is Signal::getGlobalIndex, nullptr if index >= signalCount()
+        virtual const Signal* getSignalByGlobalIndex(std::size_t index) const = 0;
+        virtual std::size_t signalCount() const = 0;
+        // name is "Signal" (only if the name is unique in the network), "Message.Signal" or "Bus.Message.Signal"
+        // (for messages merged with a bus name), nullptr if the name is unknown or ambiguous
+        virtual const Signal* getSignalByQualifiedName(const std::string& name) const = 0;
+        // resolves a whole list of qualified names at once, result[i] belongs to names[i]
+        virtual std::vector<const Signal*> getSignalsByQualifiedNames(const std::vector<std::string>& names) const = 0;
         virtual const EnvironmentVariable* getEnvironmentVariableByName(const std::string& name) const = 0;
         virtual const EnvironmentVariable* findEnvironmentVariable(std::function<bool(const EnvironmentVariable&)>&& cb) const = 0;
         virtual void forEachEnvironmentVariable(std::function<void(const EnvironmentVariable&)>&& cb) const = 0;
@@ -76,5 +86,14 @@ namespace dbcppp
         virtual const Message* findParentMessage(const Signal* sig) const = 0;
 
         void merge(std::unique_ptr<Network>&& other);
+        // like merge, the messages of other can then be found with "bus.Message.Signal" by getSignalByQualifiedName
+        void merge(std::unique_ptr<Network>&& other, const std::string& bus);
+        // compiles a decodeAll function per message with LLVM, returns false if dbcppp was built
+        // without DBCPPP_ENABLE_JIT or the compilation failed, Message::decodeAll works either way
+        bool jitCompile();
+        // precomputes the physical values of the integer signals with up to max_bit_size bits, rawToPhys becomes a
+        // table load, signals with the same bit size, value type, factor and offset share one table, the
+        // narrowest signals get their tables first until memory_budget bytes are used, returns the bytes used
+        std::size_t buildPhysTables(std::size_t max_bit_size = 12, std::size_t memory_budget = 1 << 20);
     };
 }
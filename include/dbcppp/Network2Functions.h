@@ -15,6 +15,10 @@ namespace dbcppp
     {
         DBCPPP_API std::ostream& operator<<(std::ostream& os, const Network& net);
     }
+    namespace Network2Cpp
+    {
+        DBCPPP_API std::ostream& operator<<(std::ostream& os, const Network& net);
+    }
     namespace Network2DBC
     {
         using na_t = std::tuple<const Network&, const Attribute&>;
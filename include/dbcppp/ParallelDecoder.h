@@ -0,0 +1,65 @@
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "Export.h"
+#include "Frame.h"
+#include "Network.h"
+
+namespace dbcppp
+{
+    /// \brief Decodes batches of frames on a pool of worker threads
+    ///
+    /// The frames of a batch are partitioned into shards by (bus, id), the shards are distributed over
+    /// the workers which steal shards from each other when they run out of work. All frames with the
+    /// same (bus, id) end up in the same shard and are decoded in their original order by one worker,
+    /// so the decoded values of one message keep their order. The networks are only read and must not
+    /// be modified while the decoder is in use.
+    class DBCPPP_API ParallelDecoder
+    {
+    public:
+        struct Value
+        {
+            uint64_t timestamp;
+            uint32_t bus;
+            const Message* message;
+            const Signal* signal;
+            Signal::raw_t raw;
+            double phys;
+        };
+        /// \brief Called with the values decoded by one worker
+        ///
+        /// Values of the same (bus, id) are always passed in one call and in the order of the frames.
+        using callback_t = std::function<void(const Value* values, std::size_t n)>;
+        // Value with the physical value as float, the reordered members make it 40 instead of 48 bytes
+        struct FloatValue
+        {
+            uint64_t timestamp;
+            const Message* message;
+            const Signal* signal;
+            Signal::raw_t raw;
+            uint32_t bus;
+            float phys;
+        };
+        using float_callback_t = std::function<void(const FloatValue* values, std::size_t n)>;
+
+        /// @param networks networks[i] is used to decode the frames with Frame::bus == i,
+        ///                 frames of buses without network are ignored
+        /// @param n_threads number of worker threads, 0 for std::thread::hardware_concurrency()
+        static std::unique_ptr<ParallelDecoder> create(std::vector<const Network*> networks, std::size_t n_threads = 0);
+
+        virtual ~ParallelDecoder() = default;
+        virtual std::size_t getThreadCount() const = 0;
+        /// \brief Decodes all frames and calls cb on the calling thread once the batch is decoded
+        ///
+        /// Only active multiplexed signals are decoded. The value buffers passed to cb are reused by the next batch.
+        virtual void decode(const Frame* frames, std::size_t n, const callback_t& cb) = 0;
+        /// \brief Like decode, the physical values are computed with Signal::rawToPhysFloat
+        virtual void decodeFloat(const Frame* frames, std::size_t n, const float_callback_t& cb) = 0;
+    };
+}
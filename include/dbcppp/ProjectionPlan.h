@@ -0,0 +1,44 @@
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "Export.h"
+#include "Frame.h"
+#include "Network.h"
+
+namespace dbcppp
+{
+    /// \brief Decodes a fixed subset of the signals of a network into a dense array
+    ///
+    /// The plan is compiled once from a list of signals, which may belong to many messages. Per message id it
+    /// holds a tight array of only the listed signals with their multiplexer constraints, so decoding a frame
+    /// costs as many signal decodes as the message has listed signals. The physical value of signals[i] is
+    /// written to values[i], values of signals which aren't part of the frame or aren't active are left as
+    /// they are. The plan is immutable and can be used by any number of threads at once, the network must
+    /// outlive it and must not be modified while it is in use.
+    class DBCPPP_API ProjectionPlan
+    {
+    public:
+        /// @param signals the signals to decode, nullptr entries are never written
+        /// @return nullptr if a signal isn't part of network
+        static std::unique_ptr<ProjectionPlan> create(const Network& network, std::vector<const Signal*> signals);
+
+        virtual ~ProjectionPlan() = default;
+        /// the number of values, i.e. the size of the signal list
+        virtual std::size_t size() const = 0;
+        virtual const Signal* getSignal(std::size_t index) const = 0;
+        /// false if a frame with this id doesn't write any value
+        virtual bool hasMessage(uint64_t message_id) const = 0;
+        /// \brief Decodes the listed signals of the message, returns the number of values written
+        virtual std::size_t decode(uint64_t message_id, const void* bytes, double* values) const = 0;
+        /// \brief Like decode with Signal::rawToPhysFloat
+        virtual std::size_t decode(uint64_t message_id, const void* bytes, float* values) const = 0;
+        /// \brief Decodes the frames in order, so values ends up with the latest value of every signal,
+        /// returns the number of values written
+        virtual std::size_t decode(const Frame* frames, std::size_t n, double* values) const = 0;
+    };
+}
@@ -0,0 +1,59 @@
+
+#pragma once
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "Export.h"
+#include "Network.h"
+#include "MessageDecoder.h"
+#include "ParallelDecoder.h"
+
+namespace dbcppp
+{
+    /// \brief Decides which decoded values are worth publishing
+    ///
+    /// Sits after a decoder and drops values by a rule per signal: a deadband around the last published
+    /// value, a minimum interval between two publications and publish-on-change for enum like signals.
+    /// The rules and the state of the last published values are kept in arrays indexed by
+    /// Signal::getGlobalIndex, filtering doesn't allocate. A value which is dropped is not published later,
+    /// the next value is compared against the last published one again. The filter is not thread safe.
+    class DBCPPP_API PublicationFilter
+    {
+    public:
+        /// \brief The default rule publishes every value
+        struct Rule
+        {
+            /// publish if the physical value differs by at least
+            /// max(absolute_deadband, relative_deadband * |last published physical value|)
+            double absolute_deadband = 0.;
+            double relative_deadband = 0.;
+            /// publish only if at least min_interval passed since the last publication, in units of the timestamps
+            uint64_t min_interval = 0;
+            /// publish if the raw value changed, instead of the deadbands, for signals with value descriptions
+            bool on_change = false;
+        };
+
+        static std::unique_ptr<PublicationFilter> create(const Network& network);
+
+        virtual ~PublicationFilter() = default;
+        /// sig has to be a signal of the network
+        virtual void setRule(const Signal& sig, const Rule& rule) = 0;
+        /// sets the rule of all signals
+        virtual void setRule(const Rule& rule) = 0;
+        virtual const Rule& getRule(const Signal& sig) const = 0;
+        /// \brief Whether the value is published, if so it becomes the last published value of the signal
+        ///
+        /// The first value of every signal is published.
+        virtual bool publish(const Signal& sig, uint64_t timestamp, Signal::raw_t raw, double phys) = 0;
+        /// \brief Removes the values which aren't published, keeps the order of the others
+        ///
+        /// @return the number of values left
+        virtual std::size_t filter(MessageDecoder::Value* values, std::size_t n) = 0;
+        virtual std::size_t filter(ParallelDecoder::Value* values, std::size_t n) = 0;
+        virtual std::size_t filter(ParallelDecoder::FloatValue* values, std::size_t n) = 0;
+        /// \brief Forgets the published values, the rules stay
+        virtual void reset() = 0;
+    };
+}
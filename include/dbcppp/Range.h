@@ -0,0 +1,66 @@
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+namespace dbcppp
+{
+    // lightweight random access range over an array of pointers, iterating yields const T&,
+    // unlike the forEach functions the loop body can be inlined
+    template <class T>
+    class Range
+    {
+    public:
+        class Iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            Iterator() = default;
+            explicit Iterator(const T* const* ptr)
+                : _ptr(ptr)
+            {}
+            reference operator*() const { return **_ptr; }
+            pointer operator->() const { return *_ptr; }
+            reference operator[](difference_type n) const { return *_ptr[n]; }
+            Iterator& operator++() { ++_ptr; return *this; }
+            Iterator operator++(int) { return Iterator(_ptr++); }
+            Iterator& operator--() { --_ptr; return *this; }
+            Iterator operator--(int) { return Iterator(_ptr--); }
+            Iterator& operator+=(difference_type n) { _ptr += n; return *this; }
+            Iterator& operator-=(difference_type n) { _ptr -= n; return *this; }
+            Iterator operator+(difference_type n) const { return Iterator(_ptr + n); }
+            Iterator operator-(difference_type n) const { return Iterator(_ptr - n); }
+            difference_type operator-(const Iterator& rhs) const { return _ptr - rhs._ptr; }
+            bool operator==(const Iterator& rhs) const { return _ptr == rhs._ptr; }
+            bool operator!=(const Iterator& rhs) const { return _ptr != rhs._ptr; }
+            bool operator<(const Iterator& rhs) const { return _ptr < rhs._ptr; }
+            bool operator>(const Iterator& rhs) const { return _ptr > rhs._ptr; }
+            bool operator<=(const Iterator& rhs) const { return _ptr <= rhs._ptr; }
+            bool operator>=(const Iterator& rhs) const { return _ptr >= rhs._ptr; }
+
+        private:
+            const T* const* _ptr = nullptr;
+        };
+
+        Range() = default;
+        Range(const T* const* begin, std::size_t size)
+            : _begin(begin)
+            , _size(size)
+        {}
+        Iterator begin() const { return Iterator(_begin); }
+        Iterator end() const { return Iterator(_begin + _size); }
+        std::size_t size() const { return _size; }
+        bool empty() const { return _size == 0; }
+        const T& operator[](std::size_t i) const { return *_begin[i]; }
+
+    private:
+        const T* const* _begin = nullptr;
+        std::size_t _size = 0;
+    };
+}
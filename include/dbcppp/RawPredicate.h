@@ -0,0 +1,83 @@
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "Export.h"
+#include "Signal.h"
+
+namespace dbcppp
+{
+    /// \brief A condition on the physical value of a signal which is evaluated on the raw value
+    ///
+    /// The condition is translated once into a range of raw values by inverting factor and offset, taking
+    /// the value type and the sign of the factor into account, so testing a raw value is one subtraction
+    /// and one comparison without a conversion to double. The translation is exact, i.e. the result is always
+    /// the same as comparing Signal::rawToPhys. Only the signals with ExtendedValueType::Float and ::Double,
+    /// whose raw values aren't ordered like their physical values, are tested on the physical value.
+    /// The raw values have to be sign extended like Signal::decode returns them.
+    class DBCPPP_API RawPredicate
+    {
+    public:
+        enum class Op
+        {
+            Less,
+            LessEqual,
+            Greater,
+            GreaterEqual,
+            Equal,
+            NotEqual
+        };
+
+        /// \brief phys op value
+        static RawPredicate create(const Signal& sig, Op op, double value);
+        /// \brief lower <= phys <= upper
+        static RawPredicate inRange(const Signal& sig, double lower, double upper);
+        /// \brief The value description of the raw value is label, never true if the signal has no such description
+        static RawPredicate hasLabel(const Signal& sig, const std::string& label);
+
+        inline bool operator()(Signal::raw_t raw) const noexcept
+        {
+            switch (_kind)
+            {
+            case Kind::Range: return (raw - _base <= _span) != _negate;
+            case Kind::Set: return contains(raw) != _negate;
+            default: return testPhys(raw) != _negate;
+            }
+        }
+        /// the inverse condition
+        RawPredicate operator!() const;
+        const Signal& getSignal() const;
+        /// false if the predicate has to compute the physical value
+        bool isRawDomain() const;
+
+    private:
+        enum class Kind
+        {
+            Range,
+            Set,
+            Phys
+        };
+
+        RawPredicate(const Signal& sig);
+        static RawPredicate fromBounds(const Signal& sig, double lower, bool lower_inclusive, double upper, bool upper_inclusive);
+        bool contains(Signal::raw_t raw) const noexcept;
+        bool testPhys(Signal::raw_t raw) const noexcept;
+
+        const Signal* _signal;
+        Kind _kind;
+        bool _negate;
+        // Kind::Range: raw - _base <= _span
+        uint64_t _base;
+        uint64_t _span;
+        // Kind::Set: sorted raw values
+        std::vector<uint64_t> _set;
+        // Kind::Phys
+        double _lower;
+        double _upper;
+        bool _lower_inclusive;
+        bool _upper_inclusive;
+    };
+}
@@ -0,0 +1,77 @@
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "Export.h"
+#include "Frame.h"
+#include "Network.h"
+#include "SignalStateStore.h"
+
+namespace dbcppp
+{
+    /// \brief Latest value of every signal of a network in a POSIX shared memory segment
+    ///
+    /// One process creates the table from its network and feeds it with decoded frames, any number of
+    /// other processes open it by name and read the values in place, without copies or IPC calls.
+    /// The segment starts with a versioned header, followed by a message table, a signal table, the value
+    /// slots and the names. Messages are in the order of Network::forEachMessage, signals are indexed by
+    /// Signal::getGlobalIndex and every message's values are guarded by a seqlock in its message table
+    /// entry, like in SignalStateStore. Readers don't need the network, the table carries the ids and
+    /// names, and the layout hash tells whether two tables were created from equal networks.
+    /// Only available on POSIX systems.
+    class DBCPPP_API SharedSignalTable
+    {
+    public:
+        using Value = SignalStateStore::Value;
+        static constexpr std::size_t npos = std::size_t(-1);
+
+        /// \brief Creates the segment, a segment with the same name is replaced
+        ///
+        /// @param name POSIX shared memory name, e.g. "/dbcppp_can0"
+        /// @return nullptr if the segment couldn't be created
+        static std::unique_ptr<SharedSignalTable> create(const std::string& name, const Network& network);
+        /// \brief Opens an existing segment read only
+        ///
+        /// @return nullptr if there is no such segment or its layout version is unknown
+        static std::unique_ptr<SharedSignalTable> open(const std::string& name);
+
+        /// the writer removes the segment, readers which still have it opened keep their mapping
+        virtual ~SharedSignalTable() = default;
+        virtual const std::string& getName() const = 0;
+        virtual bool isWriter() const = 0;
+        /// false once the writer destroyed the table
+        virtual bool isWriterAlive() const = 0;
+        virtual uint64_t getLayoutHash() const = 0;
+
+        virtual std::size_t messageCount() const = 0;
+        virtual uint64_t getMessageId(std::size_t message) const = 0;
+        virtual const char* getMessageName(std::size_t message) const = 0;
+        /// the signals of a message are [getFirstSignal(message), getFirstSignal(message) + getMessageSignalCount(message))
+        virtual std::size_t getFirstSignal(std::size_t message) const = 0;
+        virtual std::size_t getMessageSignalCount(std::size_t message) const = 0;
+        virtual std::size_t signalCount() const = 0;
+        virtual const char* getSignalName(std::size_t signal) const = 0;
+        virtual std::size_t getSignalMessage(std::size_t signal) const = 0;
+        /// npos if there is no such message
+        virtual std::size_t findMessage(uint64_t id) const = 0;
+        /// npos if there is no such signal
+        virtual std::size_t findSignal(const std::string& message_name, const std::string& signal_name) const = 0;
+
+        /// \brief Decodes the active signals of msg, which must be a message of the network, and stores their values
+        ///
+        /// Only the writer can update the table, the calls are ignored for readers.
+        virtual void update(const Message& msg, const void* bytes, uint64_t timestamp) = 0;
+        /// \brief Looks up the message by Frame::id and stores its values, false if the network has no such message
+        virtual bool update(const Frame& frame) = 0;
+        /// \brief Consistent copy of the values of a message, like SignalStateStore::snapshot
+        ///
+        /// values[i] receives the signal getFirstSignal(message) + i.
+        virtual uint64_t snapshot(std::size_t message, Value* values) const = 0;
+        /// \brief The latest value of one signal, like SignalStateStore::load
+        virtual uint64_t load(std::size_t signal, Value& value) const = 0;
+    };
+}
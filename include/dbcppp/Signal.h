@@ -83,12 +83,26 @@ namespace dbcppp
         virtual void forEachReceiver(std::function<void(const std::string&)>&& cb) const = 0;
         virtual const std::string* getValueDescriptionByValue(int64_t value) const = 0;
         virtual void forEachValueDescription(std::function<void(int64_t, const std::string&)>&& cb) const = 0;
+        // the id of a value description is its position in the signal's value descriptions ordered by value
+        static constexpr uint32_t NoValueDescription = 0xFFFFFFFF;
+        // looks up the value descriptions of n raw values (e.g. returned by decode) at once,
+        // ids[i] is NoValueDescription if raws[i] has no description
+        virtual void getValueDescriptionIds(const uint64_t* raws, std::size_t n, uint32_t* ids) const = 0;
+        virtual const std::string* getValueDescriptionById(uint32_t id) const = 0;
+        virtual std::size_t valueDescriptionCount() const = 0;
         virtual const Attribute* getAttributeValueByName(const std::string& name) const = 0;
         virtual const Attribute* findAttributeValue(std::function<bool(const Attribute&)>&& pred) const = 0;
         virtual const void forEachAttributeValue(std::function<void(const Attribute&)>&& cb) const = 0;
         virtual const std::string& getComment() const = 0;
         virtual ExtendedValueType getExtendedValueType() const = 0;
         virtual bool getError(ErrorCode code) const = 0;
+        // position of the signal in its message, the signals of a message are ordered by start bit
+        virtual std::size_t getIndex() const = 0;
+        // position of the signal in its network, counting through the messages ordered by id
+        virtual std::size_t getGlobalIndex() const = 0;
+        // number of decimal digits after the point of the exact fixed point representation of the physical values,
+        // -1 for float and double signals and if factor or offset need more than 15 significant decimal digits (1/3)
+        virtual int32_t getDecimalScale() const = 0;
         
         /// \brief Extracts the raw value from a given n byte array
         ///
@@ -109,13 +123,27 @@ namespace dbcppp
         inline void encode(raw_t raw, void* buffer) const noexcept { return _encode(this, raw, buffer); }
 
         inline double rawToPhys(raw_t raw) const { return _raw_to_phys(this, raw); }
+        // rawToPhys rounded to float, ExtendedValueType::Float signals without scaling return the value on the wire bit by bit
+        inline float rawToPhysFloat(raw_t raw) const { return _raw_to_phys_float(this, raw); }
         inline raw_t physToRaw(double phys) const { return _phys_to_raw(this, phys); }
 
+        /// \brief Converts a raw value into the exact physical value mantissa * 10^-getDecimalScale()
+        ///
+        /// The conversion doesn't touch floating point, so a factor of 0.1 doesn't introduce rounding artifacts.
+        /// Returns false if the signal has no decimal scale or the mantissa doesn't fit into an int64_t.
+        inline bool rawToDecimal(raw_t raw, int64_t& mantissa) const noexcept { return _raw_to_decimal(this, raw, &mantissa); }
+        /// \brief Like rawToDecimal, but the physical value is mantissa * 10^-scale with a caller chosen scale
+        ///
+        /// Returns false additionally if scale is smaller than getDecimalScale().
+        bool rawToDecimal(raw_t raw, int32_t scale, int64_t& mantissa) const noexcept;
+
     protected:
         // instead of using virtuals dynamic dispatching use function pointers
         raw_t (*_decode)(const Signal* sig, const void* bytes) noexcept {nullptr};
         void (*_encode)(const Signal* sig, raw_t raw, void* buffer) noexcept {nullptr};
         double (*_raw_to_phys)(const Signal* sig, raw_t raw) noexcept {nullptr};
+        float (*_raw_to_phys_float)(const Signal* sig, raw_t raw) noexcept {nullptr};
         raw_t (*_phys_to_raw)(const Signal* sig, double phys) noexcept {nullptr};
+        bool (*_raw_to_decimal)(const Signal* sig, raw_t raw, int64_t* mantissa) noexcept {nullptr};
     };
 }
@@ -0,0 +1,48 @@
+
+#pragma once
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "Export.h"
+#include "Frame.h"
+#include "Network.h"
+
+namespace dbcppp
+{
+    /// \brief Latest value of every signal of a network, written by decoder threads and read by any number of readers
+    ///
+    /// The values are stored by Signal::getGlobalIndex, each message is guarded by a seqlock: writers of the same
+    /// message serialize among themselves, writers of different messages don't interfere, and readers never block
+    /// writers but retry if a writer updated the message while they were copying it. The network must not be
+    /// modified while the store is in use.
+    class DBCPPP_API SignalStateStore
+    {
+    public:
+        struct Value
+        {
+            uint64_t timestamp;
+            Signal::raw_t raw;
+            double phys;
+            /// the message update which wrote the value, 0 if the signal was never written,
+            /// multiplexed signals which weren't active in the latest update keep older values
+            uint64_t update;
+        };
+
+        static std::unique_ptr<SignalStateStore> create(const Network& network);
+
+        virtual ~SignalStateStore() = default;
+        virtual const Network& getNetwork() const = 0;
+        /// \brief Decodes the active signals of msg, which must be a message of the network, and stores their values
+        virtual void update(const Message& msg, const void* bytes, uint64_t timestamp) = 0;
+        /// \brief Looks up the message by Frame::id and stores its values, false if the network has no such message
+        virtual bool update(const Frame& frame) = 0;
+        /// \brief Consistent copy of the values of all signals of msg, values[i] receives the signal with index i
+        ///
+        /// Returns the number of updates of msg so far, Value::update equals it for the values of the latest update.
+        virtual uint64_t snapshot(const Message& msg, Value* values) const = 0;
+        /// \brief The latest value of one signal, returns the number of updates of its message like snapshot
+        virtual uint64_t load(const Signal& sig, Value& value) const = 0;
+    };
+}
@@ -0,0 +1,56 @@
+
+#pragma once
+
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "Export.h"
+#include "Frame.h"
+#include "Network.h"
+
+namespace dbcppp
+{
+    /// \brief Per signal statistics of the decoded values over tumbling windows
+    ///
+    /// The frames are decoded with Message::decodeAll (so the JIT compiled decoders are used if there are
+    /// any) and aggregated right away instead of materializing the values. The state is kept in arrays
+    /// indexed by Signal::getGlobalIndex, the signals of one message are adjacent, so a frame updates a
+    /// contiguous range of every array in one branch free loop. NaN values and inactive multiplexed signals
+    /// aren't counted. A window is closed by the first frame with a timestamp beyond it or by flush, frames
+    /// with older timestamps are added to the current window. The network must not be modified while the
+    /// statistics are in use.
+    class DBCPPP_API SignalStatistics
+    {
+    public:
+        struct Aggregate
+        {
+            const Signal* signal;
+            uint64_t count;
+            double min;
+            double max;
+            double mean;
+            /// population variance
+            double variance;
+            double last;
+            uint64_t last_timestamp;
+        };
+        /// \brief Called with the aggregates of the signals which had values in the window
+        ///
+        /// window_start is a multiple of the window length, the aggregates are ordered by Signal::getGlobalIndex.
+        using callback_t = std::function<void(uint64_t window_start, const Aggregate* aggregates, std::size_t n)>;
+
+        /// @param window length of the windows in units of Frame::timestamp, i.e. 1000000000 for one second
+        static std::unique_ptr<SignalStatistics> create(const Network& network, uint64_t window, callback_t cb);
+
+        virtual ~SignalStatistics() = default;
+        virtual uint64_t getWindow() const = 0;
+        /// \brief Decodes and aggregates the frames, the messages are looked up by Frame::id, Frame::bus is ignored
+        virtual void add(const Frame* frames, std::size_t n) = 0;
+        /// \brief Decodes and aggregates one message, which must be a message of the network
+        virtual void add(const Message& msg, const void* bytes, uint64_t timestamp) = 0;
+        /// \brief Closes the current window, if it has values
+        virtual void flush() = 0;
+    };
+}
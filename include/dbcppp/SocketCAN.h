@@ -0,0 +1,41 @@
+
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include "Export.h"
+#include "Frame.h"
+
+namespace dbcppp
+{
+    /// \brief Raw SocketCAN reader which receives frames in batches using `recvmmsg`
+    ///
+    /// Frames are received directly into the caller's Frame array and stamped with
+    /// the kernel's receive timestamp. Only available on Linux.
+    class DBCPPP_API SocketCAN
+    {
+    public:
+        /// \brief Opens a raw CAN socket bound to the given interface (e.g. "vcan0")
+        ///
+        /// @param interface_name name of the CAN interface
+        /// @param bus value which gets written to Frame::bus of every received frame
+        /// @param batch_size maximum number of frames received with one system call
+        /// @return nullptr if the interface couldn't be opened
+        static std::unique_ptr<SocketCAN> create(
+              const std::string& interface_name
+            , uint32_t bus
+            , std::size_t batch_size = 64);
+
+        virtual ~SocketCAN() = default;
+        virtual const std::string& getInterfaceName() const = 0;
+        virtual int getFileDescriptor() const = 0;
+        /// \brief Receives up to n frames
+        ///
+        /// Blocks until at least one frame is available. Error frames are dropped.
+        /// @return number of frames written to frames, 0 on error
+        virtual std::size_t receive(Frame* frames, std::size_t n) = 0;
+    };
+}
@@ -0,0 +1,189 @@
+
+#include <array>
+#include <random>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+
+#include <benchmark/benchmark.h>
+
+#include "../../include/dbcppp/Network.h"
+#include "../libdbcppp/DBCAST2Network.h"
+#include "../libdbcppp/SignalImpl.h"
+#include "../Test/Generators.h"
+#include "../Test/Config.h"
+
+using namespace dbcppp;
+
+namespace
+{
+    // state shared by all benchmarks, range(0) selects the DBC: 0 = Test.dbc, 1 = generated with 1000 messages
+    struct Data
+    {
+        std::string dbc;
+        G_Network gnet;
+        std::unique_ptr<Network> net;
+        std::vector<const Message*> messages;
+        std::vector<const Signal*> signals_by_alignment[3];
+        std::vector<const Signal*> signals;
+        std::vector<uint64_t> ids;
+        std::vector<std::array<uint8_t, 64>> data;
+    };
+    const Data& get_data(int64_t which)
+    {
+        static std::unique_ptr<Data> datas[2];
+        auto& result = datas[which];
+        if (result)
+        {
+            return *result;
+        }
+        result = std::make_unique<Data>();
+        std::default_random_engine rng(0);
+        std::uniform_int_distribution<std::mt19937::result_type> dist(0, -1);
+        if (which == 0)
+        {
+            std::ifstream is(TEST_DBC);
+            result->dbc.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+        }
+        else
+        {
+            result->dbc = generate_random_dbc(1000, 8, rng);
+        }
+        auto begin{result->dbc.begin()}, end{result->dbc.end()};
+        NetworkGrammar<std::string::iterator> g(begin);
+        phrase_parse(begin, end, g, boost::spirit::ascii::space, result->gnet);
+        result->net = DBCAST2Network(result->gnet);
+        result->net->forEachMessage(
+            [&](const Message& msg)
+            {
+                result->messages.push_back(&msg);
+                msg.forEachSignal(
+                    [&](const Signal& sig)
+                    {
+                        result->signals.push_back(&sig);
+                        result->signals_by_alignment[std::size_t(static_cast<const SignalImpl&>(sig)._alignment)].push_back(&sig);
+                    });
+            });
+        for (std::size_t i = 0; i < 4096; i++)
+        {
+            result->ids.push_back(result->messages[dist(rng) % result->messages.size()]->getId());
+        }
+        result->data.resize(64);
+        for (auto& d : result->data)
+        {
+            for (auto& b : d)
+            {
+                b = uint8_t(dist(rng));
+            }
+        }
+        return *result;
+    }
+}
+
+static void BM_Parse(benchmark::State& state)
+{
+    const auto& d = get_data(state.range(0));
+    std::string dbc = d.dbc;
+    for (auto _ : state)
+    {
+        auto begin{dbc.begin()}, end{dbc.end()};
+        NetworkGrammar<std::string::iterator> g(begin);
+        G_Network gnet;
+        benchmark::DoNotOptimize(phrase_parse(begin, end, g, boost::spirit::ascii::space, gnet));
+    }
+    state.SetBytesProcessed(state.iterations() * int64_t(dbc.size()));
+}
+BENCHMARK(BM_Parse)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_DBCAST2Network(benchmark::State& state)
+{
+    const auto& d = get_data(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(DBCAST2Network(d.gnet));
+    }
+}
+BENCHMARK(BM_DBCAST2Network)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_GetMessageById(benchmark::State& state)
+{
+    const auto& d = get_data(state.range(0));
+    for (auto _ : state)
+    {
+        for (uint64_t id : d.ids)
+        {
+            benchmark::DoNotOptimize(d.net->getMessageById(id));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(d.ids.size()));
+}
+BENCHMARK(BM_GetMessageById)->Arg(0)->Arg(1);
+
+template <Alignment aAlignment>
+static void BM_Decode(benchmark::State& state)
+{
+    const auto& d = get_data(1);
+    const auto& sigs = d.signals_by_alignment[std::size_t(aAlignment)];
+    if (sigs.empty())
+    {
+        state.SkipWithError("no signal with this alignment");
+        return;
+    }
+    for (auto _ : state)
+    {
+        for (const auto& data : d.data)
+        {
+            for (const Signal* sig : sigs)
+            {
+                benchmark::DoNotOptimize(sig->decode(&data[0]));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(d.data.size() * sigs.size()));
+}
+BENCHMARK_TEMPLATE(BM_Decode, Alignment::size_inbetween_first_64_bit);
+BENCHMARK_TEMPLATE(BM_Decode, Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit);
+BENCHMARK_TEMPLATE(BM_Decode, Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit);
+
+static void BM_Encode(benchmark::State& state)
+{
+    const auto& d = get_data(1);
+    std::vector<Signal::raw_t> raws;
+    for (const Signal* sig : d.signals)
+    {
+        raws.push_back(sig->decode(&d.data[0][0]));
+    }
+    alignas(8) uint8_t buffer[64] = {};
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < d.signals.size(); i++)
+        {
+            d.signals[i]->encode(raws[i], buffer);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(d.signals.size()));
+}
+BENCHMARK(BM_Encode);
+
+static void BM_RawToPhys(benchmark::State& state)
+{
+    const auto& d = get_data(1);
+    std::vector<Signal::raw_t> raws;
+    for (const Signal* sig : d.signals)
+    {
+        raws.push_back(sig->decode(&d.data[0][0]));
+    }
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < d.signals.size(); i++)
+        {
+            benchmark::DoNotOptimize(d.signals[i]->rawToPhys(raws[i]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * int64_t(d.signals.size()));
+}
+BENCHMARK(BM_RawToPhys);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,2 @@
+
+#define TEST_DBC "/root/repo/src/Test/Test.dbc"
@@ -0,0 +1,80 @@
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/CApi.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+static std::unique_ptr<dbcppp::Signal> create_signal(uint64_t bit_size, dbcppp::Signal::ValueType value_type
+    , double factor, double offset, dbcppp::Signal::ExtendedValueType extended_value_type = dbcppp::Signal::ExtendedValueType::Integer)
+{
+    return dbcppp::Signal::create(8, "s", dbcppp::Signal::Multiplexer::NoMux, 0, 0, bit_size
+        , dbcppp::Signal::ByteOrder::LittleEndian, value_type, factor, offset, 0, 0, ""
+        , {}, {}, {}, "", extended_value_type);
+}
+BOOST_AUTO_TEST_CASE(Decimal)
+{
+    BOOST_TEST_MESSAGE("Testing Signal::rawToDecimal...");
+
+    using VT = dbcppp::Signal::ValueType;
+    BOOST_REQUIRE_EQUAL(create_signal(8, VT::Unsigned, 1, 0)->getDecimalScale(), 0);
+    BOOST_REQUIRE_EQUAL(create_signal(8, VT::Unsigned, 0.1, -40)->getDecimalScale(), 1);
+    BOOST_REQUIRE_EQUAL(create_signal(8, VT::Unsigned, 0.25, 0.5)->getDecimalScale(), 2);
+    BOOST_REQUIRE_EQUAL(create_signal(8, VT::Unsigned, 1. / 1024, 0)->getDecimalScale(), 10);
+    BOOST_REQUIRE_EQUAL(create_signal(8, VT::Unsigned, 0.001, 0.1)->getDecimalScale(), 3);
+    BOOST_REQUIRE_EQUAL(create_signal(8, VT::Unsigned, 1. / 3, 0)->getDecimalScale(), -1);
+    BOOST_REQUIRE_EQUAL(create_signal(8, VT::Unsigned, 1, 1. / 3)->getDecimalScale(), -1);
+    BOOST_REQUIRE_EQUAL(create_signal(32, VT::Signed, 0.1, 0, dbcppp::Signal::ExtendedValueType::Float)->getDecimalScale(), -1);
+    int64_t mantissa = 0;
+    BOOST_REQUIRE(!create_signal(8, VT::Unsigned, 1. / 3, 0)->rawToDecimal(1, mantissa));
+
+    auto sig = create_signal(16, VT::Unsigned, 0.1, -40);
+    BOOST_REQUIRE(sig->rawToDecimal(123, mantissa));
+    BOOST_REQUIRE_EQUAL(mantissa, -277);
+    BOOST_REQUIRE(sig->rawToDecimal(123, 4, mantissa));
+    BOOST_REQUIRE_EQUAL(mantissa, -277000);
+    BOOST_REQUIRE(!sig->rawToDecimal(123, 0, mantissa));
+    BOOST_REQUIRE(!sig->rawToDecimal(123, 30, mantissa));
+
+    // sign extended raw value as returned by decode
+    auto signed_sig = create_signal(8, VT::Signed, 0.1, 0);
+    BOOST_REQUIRE(signed_sig->rawToDecimal(uint64_t(-5), mantissa));
+    BOOST_REQUIRE_EQUAL(mantissa, -5);
+
+    // overflow
+    auto wide = create_signal(64, VT::Unsigned, 1000, 0);
+    BOOST_REQUIRE(!wide->rawToDecimal(uint64_t(1) << 62, mantissa));
+    BOOST_REQUIRE(!wide->rawToDecimal(~uint64_t(0), mantissa));
+    BOOST_REQUIRE(wide->rawToDecimal(5, mantissa));
+    BOOST_REQUIRE_EQUAL(mantissa, 5000);
+    BOOST_REQUIRE(!wide->rawToDecimal(uint64_t(1) << 50, 6, mantissa));
+
+    // the decimal value matches rawToPhys up to the rounding of the double
+    std::default_random_engine rng(0);
+    std::uniform_int_distribution<uint64_t> dist(0, 0xFFFF);
+    for (double factor : {1., 0.1, 0.01, 0.05, 0.25, 0.125, 0.001, 1. / 1024, 2.5, 10.})
+    {
+        for (double offset : {0., -40., 0.5, -273.15, 1000.})
+        {
+            auto s = create_signal(16, VT::Signed, factor, offset);
+            BOOST_REQUIRE_GE(s->getDecimalScale(), 0);
+            for (std::size_t i = 0; i < 100; i++)
+            {
+                uint64_t raw = dist(rng);
+                raw = raw & 0x8000 ? raw | ~uint64_t(0xFFFF) : raw;
+                BOOST_REQUIRE(s->rawToDecimal(raw, mantissa));
+                double phys = s->rawToPhys(raw);
+                BOOST_REQUIRE_CLOSE_FRACTION(double(mantissa) / std::pow(10., s->getDecimalScale()), phys, 1e-12);
+            }
+        }
+    }
+
+    auto csig = reinterpret_cast<const dbcppp_Signal*>(sig.get());
+    BOOST_REQUIRE_EQUAL(dbcppp_SignalGetDecimalScale(csig), 1);
+    BOOST_REQUIRE(dbcppp_SignalRawToDecimal(csig, 123, 2, &mantissa));
+    BOOST_REQUIRE_EQUAL(mantissa, -2770);
+}
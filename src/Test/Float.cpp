@@ -0,0 +1,56 @@
+
+#include <limits>
+#include <cstring>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/CApi.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+static std::unique_ptr<dbcppp::Signal> create_signal(uint64_t bit_size, double factor, double offset
+    , dbcppp::Signal::ExtendedValueType extended_value_type)
+{
+    return dbcppp::Signal::create(8, "s", dbcppp::Signal::Multiplexer::NoMux, 0, 0, bit_size
+        , dbcppp::Signal::ByteOrder::LittleEndian, dbcppp::Signal::ValueType::Signed, factor, offset, 0, 0, ""
+        , {}, {}, {}, "", extended_value_type);
+}
+static uint64_t float_bits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+BOOST_AUTO_TEST_CASE(RawToPhysFloat)
+{
+    BOOST_TEST_MESSAGE("Testing Signal::rawToPhysFloat...");
+
+    // unscaled float signals are passed through bit exact
+    auto sig = create_signal(32, 1, 0, dbcppp::Signal::ExtendedValueType::Float);
+    for (float value : {0.f, -0.f, 1.5f, -3.25e-20f, std::numeric_limits<float>::max()
+        , std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::infinity()})
+    {
+        uint64_t raw = float_bits(value);
+        BOOST_REQUIRE_EQUAL(float_bits(sig->rawToPhysFloat(raw)), raw);
+        BOOST_REQUIRE_EQUAL(sig->rawToPhysFloat(raw), float(sig->rawToPhys(raw)));
+    }
+    uint64_t nan = float_bits(std::numeric_limits<float>::quiet_NaN());
+    BOOST_REQUIRE_EQUAL(float_bits(sig->rawToPhysFloat(nan)), nan);
+
+    // everything else is the rounded double value
+    auto scaled = create_signal(32, 0.5, 1, dbcppp::Signal::ExtendedValueType::Float);
+    BOOST_REQUIRE_EQUAL(scaled->rawToPhysFloat(float_bits(3.f)), 2.5f);
+    auto integer = create_signal(16, 0.1, -40, dbcppp::Signal::ExtendedValueType::Integer);
+    for (uint64_t raw : {uint64_t(0), uint64_t(123), uint64_t(-5), uint64_t(32767)})
+    {
+        BOOST_REQUIRE_EQUAL(integer->rawToPhysFloat(raw), float(integer->rawToPhys(raw)));
+    }
+    auto dbl = create_signal(64, 1, 0, dbcppp::Signal::ExtendedValueType::Double);
+    double d = 1e300;
+    uint64_t raw;
+    std::memcpy(&raw, &d, sizeof(raw));
+    BOOST_REQUIRE_EQUAL(dbl->rawToPhysFloat(raw), std::numeric_limits<float>::infinity());
+
+    auto csig = reinterpret_cast<const dbcppp_Signal*>(integer.get());
+    BOOST_REQUIRE_EQUAL(dbcppp_SignalRawToPhysFloat(csig, 123), integer->rawToPhysFloat(123));
+}
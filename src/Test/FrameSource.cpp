@@ -0,0 +1,72 @@
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+
+#include "../../include/dbcppp/FrameSource.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+BOOST_AUTO_TEST_CASE(FrameSource)
+{
+    BOOST_TEST_MESSAGE("Testing FrameSource for correctness...");
+
+    auto filename = (std::filesystem::temp_directory_path() / "dbcppp_FrameSource.log").string();
+    // big enough that lines get split over several chunks
+    const std::size_t n_lines = 100000;
+    {
+        std::ofstream log(filename);
+        for (std::size_t i = 0; i < n_lines; i++)
+        {
+            switch (i % 4)
+            {
+            case 0: log << "  vcan0  123   [3]  11 22 33\n"; break;
+            case 1: log << "(1600000000.500000) can1 1ABCDEF0#0102030405060708\n"; break;
+            case 2: log << "  vcan0  123   [2]  remote request\n"; break;
+            case 3: log << "(1600000000.000001)  vcan0  7FF   [0] \n"; break;
+            }
+        }
+    }
+    for (auto backend : {dbcppp::FrameSource::Backend::Read, dbcppp::FrameSource::Backend::IoUring})
+    {
+        auto source = dbcppp::FrameSource::create(filename, backend);
+        BOOST_REQUIRE(source);
+        std::vector<dbcppp::Frame> frames(1000);
+        std::size_t n_frames = 0;
+        while (std::size_t n = source->read(&frames[0], frames.size()))
+        {
+            for (std::size_t i = 0; i < n; i++, n_frames++)
+            {
+                const auto& frame = frames[i];
+                switch (n_frames % 3)
+                {
+                case 0:
+                    BOOST_REQUIRE_EQUAL(source->getBusName(frame.bus), "vcan0");
+                    BOOST_REQUIRE_EQUAL(frame.id, 0x123);
+                    BOOST_REQUIRE_EQUAL(frame.size, 3);
+                    BOOST_REQUIRE_EQUAL(frame.data[2], 0x33);
+                    BOOST_REQUIRE_EQUAL(frame.timestamp, 0);
+                    break;
+                case 1:
+                    BOOST_REQUIRE_EQUAL(source->getBusName(frame.bus), "can1");
+                    BOOST_REQUIRE_EQUAL(frame.id, 0x9ABCDEF0);
+                    BOOST_REQUIRE_EQUAL(frame.size, 8);
+                    BOOST_REQUIRE_EQUAL(frame.data[7], 0x08);
+                    BOOST_REQUIRE_EQUAL(frame.timestamp, 1600000000500000000ull);
+                    break;
+                case 2:
+                    BOOST_REQUIRE_EQUAL(source->getBusName(frame.bus), "vcan0");
+                    BOOST_REQUIRE_EQUAL(frame.id, 0x7FF);
+                    BOOST_REQUIRE_EQUAL(frame.size, 0);
+                    BOOST_REQUIRE_EQUAL(frame.timestamp, 1600000000000001000ull);
+                    break;
+                }
+            }
+        }
+        BOOST_REQUIRE_EQUAL(n_frames, n_lines / 4 * 3);
+    }
+    std::remove(filename.c_str());
+}
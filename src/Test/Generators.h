@@ -0,0 +1,117 @@
+
+#pragma once
+
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../../include/dbcppp/Signal.h"
+
+// random signals, data and DBC files, shared by the tests and the benchmarks
+
+inline auto generate_random_signal(
+      std::size_t max_msg_byte_size
+    , std::default_random_engine& rng)
+{
+    using namespace dbcppp;
+
+    std::vector<std::size_t> indices;
+    for (std::size_t i = 0; i < max_msg_byte_size * 8; i++) indices.push_back(i);
+
+    std::uniform_int_distribution<std::mt19937::result_type> dist(0, -1);
+    std::unique_ptr<Signal> sig;
+    auto rnd_msg_byte_size = dist(rng) % max_msg_byte_size + 1;
+    auto rnd_byte_order = dist(rng) % 2 == 0 ? Signal::ByteOrder::LittleEndian : Signal::ByteOrder::BigEndian;
+    auto rnd_value_type = dist(rng) % 2 == 0 ? Signal::ValueType::Unsigned : Signal::ValueType::Signed;
+    auto rnd_bit_size = dist(rng) % (((rnd_msg_byte_size > 8) ? 8 : rnd_msg_byte_size) * 8) + 1;
+    Signal::ExtendedValueType rnd_extended_value_type = Signal::ExtendedValueType::Integer;
+    auto rnd_evt = dist(rng) % 3;
+    if (rnd_msg_byte_size >= 4)
+    {
+        if (std::numeric_limits<float>::is_iec559 && rnd_evt == 1)
+        {
+            rnd_extended_value_type = Signal::ExtendedValueType::Float;
+            rnd_bit_size = 32;
+        }
+        else if (std::numeric_limits<double>::is_iec559 && rnd_msg_byte_size >= 8 && rnd_evt == 2)
+        {
+            rnd_extended_value_type = Signal::ExtendedValueType::Double;
+            rnd_bit_size = 64;
+        }
+    }
+    if (rnd_byte_order == Signal::ByteOrder::LittleEndian)
+    {
+        uint64_t rnd_start_bit = 0;
+        if ((rnd_msg_byte_size * 8 - rnd_bit_size) != 0)
+        {
+            rnd_start_bit = dist(rng) % (rnd_msg_byte_size * 8 - rnd_bit_size);
+        }
+        sig = Signal::create(rnd_msg_byte_size, "Signal", Signal::Multiplexer::NoMux, 0, rnd_start_bit, rnd_bit_size,
+            rnd_byte_order, rnd_value_type, 1.0, 0.0, 0.0, 0.0, "", {}, {}, {}, "", rnd_extended_value_type);
+    }
+    else
+    {
+        std::random_device rd;
+        std::mt19937 g(rd());
+        std::shuffle(indices.begin(), indices.end(), g);
+        for (auto rnd_start_bit : indices)
+        {
+            sig = Signal::create(rnd_msg_byte_size, "Signal", Signal::Multiplexer::NoMux, 0, rnd_start_bit, rnd_bit_size,
+                rnd_byte_order, rnd_value_type, 1.0, 0.0, 0.0, 0.0, "", {}, {}, {}, "", rnd_extended_value_type);
+            if (sig)
+            {
+                break;
+            }
+        }
+    }
+    return std::move(sig);
+}
+inline auto generate_random_data(
+      std::size_t max_msg_byte_size
+    , std::default_random_engine& rng)
+{
+    std::vector<uint8_t> result;
+    std::uniform_int_distribution<std::mt19937::result_type> dist(0, -1);
+    for (std::size_t j = 0; j < max_msg_byte_size; j++) result.push_back(uint8_t(dist(rng) & 0xFF));
+    return result;
+}
+// generates a DBC file with n_messages messages of 8 or 64 byte, each with signals_per_message random signals
+inline std::string generate_random_dbc(
+      std::size_t n_messages
+    , std::size_t signals_per_message
+    , std::default_random_engine& rng)
+{
+    using namespace dbcppp;
+
+    std::uniform_int_distribution<std::mt19937::result_type> dist(0, -1);
+    std::ostringstream dbc;
+    dbc << "VERSION \"generated\"\n\nNS_:\n\nBS_:\n\nBU_: ECU\n\n";
+    std::ostringstream vals;
+    for (std::size_t i = 0; i < n_messages; i++)
+    {
+        std::size_t msg_size = i % 4 == 3 ? 64 : 8;
+        dbc << "BO_ " << i << " msg_" << i << ": " << msg_size << " ECU\n";
+        for (std::size_t j = 0; j < signals_per_message; j++)
+        {
+            auto sig = generate_random_signal(msg_size, rng);
+            while (sig->getError(Signal::ErrorCode::SignalExceedsMessageSize))
+            {
+                sig = generate_random_signal(msg_size, rng);
+            }
+            dbc << " SG_ sig_" << i << "_" << j << " : " << sig->getStartBit() << "|" << sig->getBitSize()
+                << (sig->getByteOrder() == Signal::ByteOrder::LittleEndian ? "@1" : "@0")
+                << (sig->getValueType() == Signal::ValueType::Signed ? "-" : "+")
+                << " (" << (dist(rng) % 100 + 1) / 10. << "," << int(dist(rng) % 100) - 50 << ") [0|0] \"unit\" ECU\n";
+            if (j % 10 == 0)
+            {
+                vals << "VAL_ " << i << " sig_" << i << "_" << j << " 0 \"off\" 1 \"on\" 2 \"error\" ;\n";
+            }
+        }
+        dbc << "\n";
+    }
+    dbc << vals.str();
+    return dbc.str();
+}
@@ -0,0 +1,91 @@
+
+#include <random>
+#include <vector>
+#include <cstring>
+#include <sstream>
+#include <fstream>
+
+#include "../../include/dbcppp/Network.h"
+#include "Generators.h"
+#include "Config.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+static double raw_to_phys(const dbcppp::Signal& sig, uint64_t raw, double*)
+{
+    return sig.rawToPhys(raw);
+}
+static float raw_to_phys(const dbcppp::Signal& sig, uint64_t raw, float*)
+{
+    return sig.rawToPhysFloat(raw);
+}
+template <class T>
+static void check_decode_all(const dbcppp::Network& net, std::default_random_engine& rng)
+{
+    std::uniform_int_distribution<int> dist(0, 255);
+    net.forEachMessage(
+        [&](const dbcppp::Message& msg)
+        {
+            std::vector<const dbcppp::Signal*> signals;
+            msg.forEachSignal(
+                [&](const dbcppp::Signal& sig)
+                {
+                    signals.push_back(&sig);
+                });
+            const dbcppp::Signal* mux_sig = msg.getMuxSignal();
+            for (std::size_t i = 0; i < 100; i++)
+            {
+                alignas(8) uint8_t data[72];
+                for (auto& b : data)
+                {
+                    b = uint8_t(dist(rng));
+                }
+                std::vector<T> values(signals.size(), T(42));
+                msg.decodeAll(data, values.data());
+                for (std::size_t j = 0; j < signals.size(); j++)
+                {
+                    const dbcppp::Signal* sig = signals[j];
+                    T expected = T(42);
+                    if (sig->getMultiplexerIndicator() != dbcppp::Signal::Multiplexer::MuxValue ||
+                        mux_sig && sig->getMultiplexerSwitchValue() == mux_sig->decode(data))
+                    {
+                        expected = raw_to_phys(*sig, sig->decode(data), static_cast<T*>(nullptr));
+                    }
+                    // compare the bits, NaN is a valid result for float signals
+                    BOOST_REQUIRE(std::memcmp(&expected, &values[j], sizeof(T)) == 0 ||
+                        expected != expected && values[j] != values[j]);
+                }
+            }
+        });
+}
+
+BOOST_AUTO_TEST_CASE(Jit)
+{
+    BOOST_TEST_MESSAGE("Testing Message::decodeAll with and without JIT...");
+
+    std::default_random_engine rng(0);
+    std::ifstream dbc_file(TEST_DBC);
+    auto net = dbcppp::Network::fromDBC(dbc_file);
+    BOOST_REQUIRE(net);
+    std::istringstream generated(generate_random_dbc(50, 8, rng));
+    auto net_generated = dbcppp::Network::fromDBC(generated);
+    BOOST_REQUIRE(net_generated);
+    for (auto* n : {net.get(), net_generated.get()})
+    {
+        check_decode_all<double>(*n, rng);
+        check_decode_all<float>(*n, rng);
+        bool compiled = n->jitCompile();
+        n->forEachMessage(
+            [&](const dbcppp::Message& msg)
+            {
+                BOOST_CHECK_EQUAL(msg.isJitCompiled(), compiled);
+            });
+        check_decode_all<double>(*n, rng);
+        check_decode_all<float>(*n, rng);
+        // copies share the compiled code
+        auto copy = n->clone();
+        check_decode_all<double>(*copy, rng);
+        check_decode_all<float>(*copy, rng);
+    }
+}
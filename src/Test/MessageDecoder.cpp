@@ -0,0 +1,172 @@
+
+#include <map>
+#include <set>
+#include <tuple>
+#include <vector>
+#include <random>
+#include <cstring>
+#include <sstream>
+#include <fstream>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/MessageDecoder.h"
+#include "Generators.h"
+#include "Config.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+static bool covered(const dbcppp::Message::Coverage& coverage, std::size_t byte, std::size_t bit)
+{
+    return (coverage.words[byte / 8] >> (byte % 8 * 8 + bit)) & 1;
+}
+static bool is_active(const dbcppp::Message& msg, const dbcppp::Signal& sig, const uint8_t* data)
+{
+    const dbcppp::Signal* mux_sig = msg.getMuxSignal();
+    return sig.getMultiplexerIndicator() != dbcppp::Signal::Multiplexer::MuxValue ||
+        mux_sig && sig.getMultiplexerSwitchValue() == mux_sig->decode(data);
+}
+// the coverage has to be exactly the bits encode writes
+static void check_coverage(const dbcppp::Message& msg)
+{
+    auto own_bits = [](const dbcppp::Signal& sig, std::size_t byte, std::size_t bit)
+    {
+        alignas(8) uint8_t data[64] = {};
+        uint64_t raw = sig.getBitSize() == 64 ? ~uint64_t(0) : (uint64_t(1) << sig.getBitSize()) - 1;
+        sig.encode(raw, data);
+        return (data[byte] >> bit) & 1;
+    };
+    const dbcppp::Signal* mux_sig = msg.getMuxSignal();
+    for (std::size_t i = 0; i < msg.signalCount(); i++)
+    {
+        const dbcppp::Signal& sig = *msg.getSignalByIndex(i);
+        const dbcppp::Message::Coverage* coverage = msg.getSignalCoverage(i);
+        BOOST_REQUIRE(coverage);
+        bool equal = true;
+        for (std::size_t byte = 0; byte < 64; byte++)
+        {
+            for (std::size_t bit = 0; bit < 8; bit++)
+            {
+                bool expected = own_bits(sig, byte, bit) ||
+                    sig.getMultiplexerIndicator() == dbcppp::Signal::Multiplexer::MuxValue && own_bits(*mux_sig, byte, bit);
+                equal = equal && covered(*coverage, byte, bit) == expected;
+            }
+        }
+        BOOST_REQUIRE(equal);
+    }
+    BOOST_REQUIRE(msg.getSignalCoverage(msg.signalCount()) == nullptr);
+}
+static void check_decoder(const dbcppp::Network& net, std::default_random_engine& rng)
+{
+    std::vector<const dbcppp::Message*> messages;
+    net.forEachMessage(
+        [&](const dbcppp::Message& msg)
+        {
+            check_coverage(msg);
+            messages.push_back(&msg);
+        });
+    // mostly repeating frames with a few flipped bits
+    std::uniform_int_distribution<std::size_t> dist(0, 1 << 20);
+    std::map<std::pair<uint32_t, uint64_t>, dbcppp::Frame> last;
+    std::vector<dbcppp::Frame> frames(5000);
+    for (std::size_t i = 0; i < frames.size(); i++)
+    {
+        const dbcppp::Message* msg = messages[dist(rng) % messages.size()];
+        uint32_t bus = uint32_t(dist(rng) % 2);
+        auto iter = last.find(std::make_pair(bus, msg->getId()));
+        dbcppp::Frame& frame = frames[i];
+        if (iter == last.end())
+        {
+            frame = dbcppp::Frame{};
+            frame.id = uint32_t(msg->getId());
+            frame.size = uint8_t(msg->getMessageSize());
+            frame.bus = bus;
+            for (auto& b : frame.data)
+            {
+                b = uint8_t(dist(rng));
+            }
+        }
+        else
+        {
+            frame = iter->second;
+            for (std::size_t flips = dist(rng) % 4; flips < 2; flips++)
+            {
+                std::size_t bit = dist(rng) % (frame.size * 8);
+                frame.data[bit / 8] ^= uint8_t(1 << bit % 8);
+            }
+        }
+        frame.timestamp = i;
+        last[std::make_pair(bus, msg->getId())] = frame;
+    }
+
+    auto decoder = dbcppp::MessageDecoder::create({&net, &net});
+    for (std::size_t pass = 0; pass < 2; pass++)
+    {
+        using key_t = std::tuple<uint64_t, const dbcppp::Signal*>;
+        std::map<key_t, uint64_t> actual;
+        decoder->decode(&frames[0], frames.size(),
+            [&](const dbcppp::MessageDecoder::Value* values, std::size_t n)
+            {
+                for (std::size_t i = 0; i < n; i++)
+                {
+                    BOOST_REQUIRE(actual.insert(std::make_pair(key_t(values[i].timestamp, values[i].signal), values[i].raw)).second);
+                }
+            });
+        std::map<std::pair<uint32_t, uint64_t>, const dbcppp::Frame*> previous;
+        std::size_t n_expected = 0;
+        for (const auto& frame : frames)
+        {
+            const dbcppp::Message* msg = net.getMessageById(frame.id);
+            const dbcppp::Frame*& prev = previous[std::make_pair(frame.bus, uint64_t(frame.id))];
+            for (std::size_t i = 0; i < msg->signalCount(); i++)
+            {
+                const dbcppp::Signal& sig = *msg->getSignalByIndex(i);
+                if (!is_active(*msg, sig, frame.data))
+                {
+                    continue;
+                }
+                bool changed = prev == nullptr;
+                for (std::size_t byte = 0; prev && byte < 64; byte++)
+                {
+                    for (std::size_t bit = 0; bit < 8; bit++)
+                    {
+                        changed = changed || ((frame.data[byte] ^ prev->data[byte]) >> bit & 1) &&
+                            covered(*msg->getSignalCoverage(i), byte, bit);
+                    }
+                }
+                // a value which differs from the previous one is never suppressed
+                BOOST_REQUIRE(changed || sig.decode(frame.data) == sig.decode(prev->data) && is_active(*msg, sig, prev->data));
+                if (changed)
+                {
+                    auto iter = actual.find(key_t(frame.timestamp, &sig));
+                    BOOST_REQUIRE(iter != actual.end());
+                    BOOST_REQUIRE_EQUAL(iter->second, sig.decode(frame.data));
+                    n_expected++;
+                }
+            }
+            prev = &frame;
+        }
+        BOOST_REQUIRE_EQUAL(actual.size(), n_expected);
+        decoder->reset();
+    }
+    // the same frame again yields nothing
+    decoder->decode(&frames[0], 1, [](const dbcppp::MessageDecoder::Value*, std::size_t) {});
+    bool called = false;
+    decoder->decode(&frames[0], 1, [&](const dbcppp::MessageDecoder::Value*, std::size_t) { called = true; });
+    BOOST_REQUIRE(!called);
+}
+
+BOOST_AUTO_TEST_CASE(MessageDecoder)
+{
+    BOOST_TEST_MESSAGE("Testing Message::getSignalCoverage and MessageDecoder...");
+
+    std::default_random_engine rng(0);
+    std::ifstream dbc_file(TEST_DBC);
+    auto net = dbcppp::Network::fromDBC(dbc_file);
+    BOOST_REQUIRE(net);
+    std::istringstream generated(generate_random_dbc(20, 8, rng));
+    auto net_generated = dbcppp::Network::fromDBC(generated);
+    BOOST_REQUIRE(net_generated);
+    check_decoder(*net, rng);
+    check_decoder(*net_generated, rng);
+}
@@ -0,0 +1,93 @@
+
+#include <map>
+#include <tuple>
+#include <vector>
+#include <random>
+#include <cstring>
+#include <fstream>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/ParallelDecoder.h"
+#include "Config.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+BOOST_AUTO_TEST_CASE(ParallelDecoder)
+{
+    BOOST_TEST_MESSAGE("Testing ParallelDecoder for correctness...");
+
+    std::ifstream dbc_file(TEST_DBC);
+    auto net = dbcppp::Network::fromDBC(dbc_file);
+    BOOST_REQUIRE(net);
+
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<dbcppp::Frame> frames(20000);
+    for (std::size_t i = 0; i < frames.size(); i++)
+    {
+        auto& frame = frames[i];
+        frame.id = dist(rng) % 3;
+        frame.size = 8;
+        frame.bus = dist(rng) % 2;
+        frame.timestamp = i;
+        for (auto& b : frame.data)
+        {
+            b = uint8_t(dist(rng));
+        }
+    }
+    // expected raw values in frame order per (bus, id) and signal, raw because the float signals may decode to NaN
+    using key_t = std::tuple<uint32_t, uint64_t, const dbcppp::Signal*>;
+    std::map<key_t, std::vector<std::pair<uint64_t, uint64_t>>> expected;
+    for (const auto& frame : frames)
+    {
+        const dbcppp::Message* msg = net->getMessageById(frame.id);
+        if (!msg)
+        {
+            continue;
+        }
+        const dbcppp::Signal* mux_sig = msg->getMuxSignal();
+        msg->forEachSignal(
+            [&](const dbcppp::Signal& sig)
+            {
+                if (sig.getMultiplexerIndicator() != dbcppp::Signal::Multiplexer::MuxValue ||
+                    mux_sig && sig.getMultiplexerSwitchValue() == mux_sig->decode(frame.data))
+                {
+                    expected[key_t(frame.bus, frame.id, &sig)].emplace_back(frame.timestamp, sig.decode(frame.data));
+                }
+            });
+    }
+
+    auto decoder = dbcppp::ParallelDecoder::create({net.get(), net.get()}, 4);
+    BOOST_REQUIRE_EQUAL(decoder->getThreadCount(), 4);
+    for (std::size_t batch = 0; batch < 3; batch++)
+    {
+        std::map<key_t, std::vector<std::pair<uint64_t, uint64_t>>> actual;
+        decoder->decode(&frames[0], frames.size(),
+            [&](const dbcppp::ParallelDecoder::Value* values, std::size_t n)
+            {
+                for (std::size_t i = 0; i < n; i++)
+                {
+                    const auto& v = values[i];
+                    actual[key_t(v.bus, v.message->getId(), v.signal)].emplace_back(v.timestamp, v.raw);
+                }
+            });
+        BOOST_REQUIRE(actual == expected);
+    }
+    // the float variant yields the same values
+    std::map<key_t, std::vector<std::pair<uint64_t, uint64_t>>> actual;
+    bool phys_equal = true;
+    decoder->decodeFloat(&frames[0], frames.size(),
+        [&](const dbcppp::ParallelDecoder::FloatValue* values, std::size_t n)
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                const auto& v = values[i];
+                actual[key_t(v.bus, v.message->getId(), v.signal)].emplace_back(v.timestamp, v.raw);
+                float phys = v.signal->rawToPhysFloat(v.raw);
+                phys_equal = phys_equal && std::memcmp(&phys, &v.phys, sizeof(float)) == 0;
+            }
+        });
+    BOOST_REQUIRE(actual == expected);
+    BOOST_REQUIRE(phys_equal);
+}
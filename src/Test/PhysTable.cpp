@@ -0,0 +1,89 @@
+
+#include <random>
+#include <vector>
+#include <cstring>
+#include <sstream>
+#include <fstream>
+
+#include "../../include/dbcppp/Network.h"
+#include "Generators.h"
+#include "Config.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+static bool bitwise_equal(double lhs, double rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(double)) == 0;
+}
+// compares rawToPhys of net against reference, which has no tables, for all raw values of the small signals
+static void check_phys(const dbcppp::Network& net, const dbcppp::Network& reference, std::default_random_engine& rng)
+{
+    std::uniform_int_distribution<uint64_t> dist;
+    BOOST_REQUIRE_EQUAL(net.signalCount(), reference.signalCount());
+    for (std::size_t i = 0; i < net.signalCount(); i++)
+    {
+        const dbcppp::Signal* sig = net.getSignalByGlobalIndex(i);
+        const dbcppp::Signal* ref = reference.getSignalByGlobalIndex(i);
+        std::vector<uint64_t> raws;
+        if (sig->getBitSize() <= 12)
+        {
+            for (uint64_t raw = 0; raw < (uint64_t(1) << sig->getBitSize()); raw++)
+            {
+                // sign extended like decode does it
+                uint64_t sign = uint64_t(1) << (sig->getBitSize() - 1);
+                bool negative = sig->getValueType() == dbcppp::Signal::ValueType::Signed && (raw & sign);
+                raws.push_back(negative ? raw | ~(sign - 1) : raw);
+            }
+        }
+        // values outside of the signal's range
+        for (std::size_t j = 0; j < 16; j++)
+        {
+            raws.push_back(dist(rng));
+        }
+        bool equal = true;
+        for (uint64_t raw : raws)
+        {
+            equal = equal && bitwise_equal(sig->rawToPhys(raw), ref->rawToPhys(raw));
+        }
+        BOOST_REQUIRE(equal);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(PhysTable)
+{
+    BOOST_TEST_MESSAGE("Testing Network::buildPhysTables...");
+
+    std::default_random_engine rng(0);
+    std::ifstream dbc_file(TEST_DBC);
+    auto net = dbcppp::Network::fromDBC(dbc_file);
+    BOOST_REQUIRE(net);
+    std::istringstream generated(generate_random_dbc(200, 8, rng));
+    auto net_generated = dbcppp::Network::fromDBC(generated);
+    BOOST_REQUIRE(net_generated);
+    for (auto* n : {net.get(), net_generated.get()})
+    {
+        auto reference = n->clone();
+        BOOST_REQUIRE_EQUAL(n->buildPhysTables(12, 0), 0);
+        std::size_t used = n->buildPhysTables(12, 1 << 20);
+        BOOST_REQUIRE_LE(used, 1 << 20);
+        check_phys(*n, *reference, rng);
+        auto copy = n->clone();
+        check_phys(*copy, *reference, rng);
+        // a budget too small for the wider tables
+        auto limited = reference->clone();
+        BOOST_REQUIRE_LE(limited->buildPhysTables(12, 4096), 4096);
+        check_phys(*limited, *reference, rng);
+    }
+    // the equal one bit signals share one table of two values
+    std::istringstream dbc(
+        "VERSION \"\"\nNS_ :\nBS_:\nBU_:\n"
+        "BO_ 1 m0: 8 Vector__XXX\n"
+        " SG_ a : 0|1@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ b : 1|1@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ c : 2|1@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ d : 8|32@1- (1,0) [0|0] \"\" Vector__XXX\n");
+    auto small = dbcppp::Network::fromDBC(dbc);
+    BOOST_REQUIRE(small);
+    BOOST_REQUIRE_EQUAL(small->buildPhysTables(), 2 * sizeof(double));
+}
@@ -0,0 +1,131 @@
+
+#include <thread>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <cstring>
+#include <sstream>
+#include <fstream>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/ProjectionPlan.h"
+#include "Generators.h"
+#include "Config.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+static bool bitwise_equal(double lhs, double rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(double)) == 0;
+}
+// decodes random frames with the plan and compares with decoding the listed signals one by one
+static bool check_plan(const dbcppp::Network& net, const dbcppp::ProjectionPlan& plan, std::default_random_engine& rng)
+{
+    std::uniform_int_distribution<int> dist(0, 255);
+    bool equal = true;
+    net.forEachMessage(
+        [&](const dbcppp::Message& msg)
+        {
+            const dbcppp::Signal* mux_sig = msg.getMuxSignal();
+            for (std::size_t i = 0; i < 20; i++)
+            {
+                alignas(8) uint8_t data[64];
+                for (auto& b : data)
+                {
+                    b = uint8_t(dist(rng));
+                }
+                std::vector<double> values(plan.size(), 42.);
+                std::vector<float> float_values(plan.size(), 42.f);
+                std::size_t n = plan.decode(msg.getId(), data, values.data());
+                equal = equal && plan.decode(msg.getId(), data, float_values.data()) == n;
+                std::size_t expected_n = 0;
+                for (std::size_t j = 0; j < plan.size(); j++)
+                {
+                    const dbcppp::Signal* sig = plan.getSignal(j);
+                    double expected = 42.;
+                    float expected_float = 42.f;
+                    if (sig && net.findParentMessage(sig) == &msg &&
+                        (sig->getMultiplexerIndicator() != dbcppp::Signal::Multiplexer::MuxValue ||
+                         mux_sig && sig->getMultiplexerSwitchValue() == mux_sig->decode(data)))
+                    {
+                        expected = sig->rawToPhys(sig->decode(data));
+                        expected_float = sig->rawToPhysFloat(sig->decode(data));
+                        expected_n++;
+                    }
+                    equal = equal && bitwise_equal(expected, values[j]) &&
+                        std::memcmp(&expected_float, &float_values[j], sizeof(float)) == 0;
+                }
+                equal = equal && n == expected_n && (n == 0 || plan.hasMessage(msg.getId()));
+            }
+        });
+    return equal;
+}
+
+BOOST_AUTO_TEST_CASE(ProjectionPlan)
+{
+    BOOST_TEST_MESSAGE("Testing ProjectionPlan...");
+
+    std::default_random_engine rng(0);
+    std::ifstream dbc_file(TEST_DBC);
+    auto net = dbcppp::Network::fromDBC(dbc_file);
+    BOOST_REQUIRE(net);
+    std::istringstream generated(generate_random_dbc(40, 8, rng));
+    auto net_generated = dbcppp::Network::fromDBC(generated);
+    BOOST_REQUIRE(net_generated);
+    for (auto* n : {net.get(), net_generated.get()})
+    {
+        // a random subset in random order, with a gap
+        std::vector<const dbcppp::Signal*> signals;
+        for (std::size_t i = 0; i < n->signalCount(); i++)
+        {
+            if (rng() % 4 == 0)
+            {
+                signals.push_back(n->getSignalByGlobalIndex(i));
+            }
+        }
+        std::shuffle(signals.begin(), signals.end(), rng);
+        signals.push_back(nullptr);
+        signals.push_back(n->getSignalByGlobalIndex(0));
+        auto plan = dbcppp::ProjectionPlan::create(*n, signals);
+        BOOST_REQUIRE(plan);
+        BOOST_REQUIRE_EQUAL(plan->size(), signals.size());
+        BOOST_REQUIRE(!plan->hasMessage(0xFFFFFFF));
+        BOOST_REQUIRE(check_plan(*n, *plan, rng));
+
+        // one plan, many threads
+        std::vector<std::thread> threads;
+        bool equal[4] = {false, false, false, false};
+        for (std::size_t t = 0; t < 4; t++)
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    std::default_random_engine thread_rng{unsigned(t)};
+                    equal[t] = check_plan(*n, *plan, thread_rng);
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        BOOST_REQUIRE(equal[0] && equal[1] && equal[2] && equal[3]);
+    }
+
+    // the latest frame wins
+    const dbcppp::Signal* sig = net->getMessageById(0)->getSignalByName("s0");
+    auto plan = dbcppp::ProjectionPlan::create(*net, {sig});
+    BOOST_REQUIRE(plan);
+    dbcppp::Frame frames[3] = {};
+    frames[0].id = 0;
+    frames[0].data[0] = 1;
+    frames[1].id = 0;
+    frames[1].data[0] = 2;
+    frames[2].id = 1;
+    double value = 0;
+    BOOST_REQUIRE_EQUAL(plan->decode(frames, 3, &value), 2);
+    BOOST_REQUIRE_EQUAL(value, 2.);
+
+    // signals of other networks are rejected
+    BOOST_REQUIRE(dbcppp::ProjectionPlan::create(*net_generated, {sig}) == nullptr);
+}
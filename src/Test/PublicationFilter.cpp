@@ -0,0 +1,101 @@
+
+#include <cmath>
+#include <vector>
+#include <sstream>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/PublicationFilter.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+BOOST_AUTO_TEST_CASE(PublicationFilter)
+{
+    BOOST_TEST_MESSAGE("Testing PublicationFilter...");
+
+    std::istringstream dbc(
+        "VERSION \"\"\nNS_ :\nBS_:\nBU_:\n"
+        "BO_ 1 m0: 8 Vector__XXX\n"
+        " SG_ speed : 0|16@1+ (0.1,0) [0|0] \"km/h\" Vector__XXX\n"
+        " SG_ temp : 16|8@1- (1,-40) [0|0] \"C\" Vector__XXX\n"
+        " SG_ gear : 24|4@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ raw : 28|4@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "VAL_ 1 gear 0 \"P\" 1 \"R\" 2 \"N\" 3 \"D\" ;\n");
+    auto net = dbcppp::Network::fromDBC(dbc);
+    BOOST_REQUIRE(net);
+    const dbcppp::Message* msg = net->getMessageById(1);
+    const dbcppp::Signal* speed = msg->getSignalByName("speed");
+    const dbcppp::Signal* temp = msg->getSignalByName("temp");
+    const dbcppp::Signal* gear = msg->getSignalByName("gear");
+    const dbcppp::Signal* raw = msg->getSignalByName("raw");
+    auto filter = dbcppp::PublicationFilter::create(*net);
+
+    dbcppp::PublicationFilter::Rule rule;
+    rule.absolute_deadband = 1.;
+    filter->setRule(*speed, rule);
+    BOOST_REQUIRE_EQUAL(filter->getRule(*speed).absolute_deadband, 1.);
+    rule = dbcppp::PublicationFilter::Rule();
+    rule.absolute_deadband = 0.5;
+    rule.relative_deadband = 0.1;
+    filter->setRule(*temp, rule);
+    rule = dbcppp::PublicationFilter::Rule();
+    rule.on_change = true;
+    rule.min_interval = 100;
+    filter->setRule(*gear, rule);
+
+    auto publish = [&](const dbcppp::Signal* sig, uint64_t timestamp, uint64_t r)
+    {
+        return filter->publish(*sig, timestamp, r, sig->rawToPhys(r));
+    };
+    // absolute deadband, compared with the last published value
+    BOOST_REQUIRE(publish(speed, 0, 1000));
+    BOOST_REQUIRE(!publish(speed, 1, 1009));
+    BOOST_REQUIRE(!publish(speed, 2, 991));
+    BOOST_REQUIRE(publish(speed, 3, 1010));
+    BOOST_REQUIRE(!publish(speed, 4, 1019));
+    BOOST_REQUIRE(publish(speed, 5, 1000));
+    // the larger of the absolute and the relative deadband: 10% of 60, then 0.5 around 0
+    BOOST_REQUIRE(publish(temp, 0, 100));
+    BOOST_REQUIRE(!publish(temp, 1, 105));
+    BOOST_REQUIRE(publish(temp, 2, 106));
+    BOOST_REQUIRE(publish(temp, 3, 40));
+    BOOST_REQUIRE(!publish(temp, 4, 40));
+    BOOST_REQUIRE(publish(temp, 5, 41));
+    // on change with a minimum interval
+    BOOST_REQUIRE(publish(gear, 1000, 0));
+    BOOST_REQUIRE(!publish(gear, 1200, 0));
+    BOOST_REQUIRE(publish(gear, 1250, 1));
+    BOOST_REQUIRE(!publish(gear, 1300, 2));
+    BOOST_REQUIRE(publish(gear, 1350, 2));
+    BOOST_REQUIRE(!publish(gear, 1351, 2));
+    // the default rule publishes everything
+    for (uint64_t t = 0; t < 5; t++)
+    {
+        BOOST_REQUIRE(publish(raw, t, 7));
+    }
+
+    // batches are compacted in place
+    filter->reset();
+    std::vector<dbcppp::MessageDecoder::Value> values;
+    for (uint64_t t = 0; t < 10; t++)
+    {
+        values.push_back(dbcppp::MessageDecoder::Value{t, 0, msg, speed, 1000 + t * 3, speed->rawToPhys(1000 + t * 3)});
+        values.push_back(dbcppp::MessageDecoder::Value{t * 100, 0, msg, gear, t / 3, gear->rawToPhys(t / 3)});
+    }
+    std::size_t n = filter->filter(values.data(), values.size());
+    std::vector<std::pair<const dbcppp::Signal*, uint64_t>> published;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        published.emplace_back(values[i].signal, values[i].raw);
+    }
+    std::vector<std::pair<const dbcppp::Signal*, uint64_t>> expected = {
+        {speed, 1000}, {gear, 0}, {gear, 1}, {speed, 1012}, {gear, 2}, {speed, 1024}, {gear, 3}};
+    BOOST_REQUIRE(published == expected);
+
+    std::vector<dbcppp::ParallelDecoder::FloatValue> float_values;
+    for (uint64_t t = 0; t < 4; t++)
+    {
+        float_values.push_back(dbcppp::ParallelDecoder::FloatValue{t, msg, temp, 100 + t, 0, temp->rawToPhysFloat(100 + t)});
+    }
+    BOOST_REQUIRE_EQUAL(filter->filter(float_values.data(), float_values.size()), 1);
+}
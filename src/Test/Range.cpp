@@ -0,0 +1,195 @@
+
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/CApi.h"
+#include "Config.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+static void check_ranges(const dbcppp::Network& net)
+{
+    std::vector<const dbcppp::Message*> messages;
+    net.forEachMessage(
+        [&](const dbcppp::Message& msg)
+        {
+            messages.push_back(&msg);
+        });
+    auto range = net.messages();
+    BOOST_REQUIRE_EQUAL(range.size(), messages.size());
+    std::size_t i = 0;
+    for (const dbcppp::Message& msg : range)
+    {
+        BOOST_REQUIRE_EQUAL(&msg, messages[i]);
+        BOOST_REQUIRE_EQUAL(&range[i], messages[i]);
+        i++;
+
+        std::vector<const dbcppp::Signal*> signals;
+        msg.forEachSignal(
+            [&](const dbcppp::Signal& sig)
+            {
+                signals.push_back(&sig);
+            });
+        auto sigs = msg.signals();
+        BOOST_REQUIRE_EQUAL(sigs.size(), signals.size());
+        BOOST_REQUIRE(std::equal(sigs.begin(), sigs.end(), signals.begin(),
+            [](const dbcppp::Signal& lhs, const dbcppp::Signal* rhs)
+            {
+                return &lhs == rhs;
+            }));
+        BOOST_REQUIRE_EQUAL(std::size_t(sigs.end() - sigs.begin()), signals.size());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Range)
+{
+    BOOST_TEST_MESSAGE("Testing Message::signals and Network::messages...");
+
+    std::ifstream dbc_file(TEST_DBC);
+    auto net = dbcppp::Network::fromDBC(dbc_file);
+    BOOST_REQUIRE(net);
+    BOOST_REQUIRE(!net->messages().empty());
+    check_ranges(*net);
+    auto copy = net->clone();
+    check_ranges(*copy);
+    BOOST_REQUIRE(&copy->messages()[0] != &net->messages()[0]);
+
+    std::istringstream other_dbc(
+        "VERSION \"\"\n"
+        "NS_ :\n"
+        "BS_:\n"
+        "BU_:\n"
+        "BO_ 1000 other: 8 Vector__XXX\n"
+        " SG_ a : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ b : 8|8@1+ (1,0) [0|0] \"\" Vector__XXX\n");
+    auto other = dbcppp::Network::fromDBC(other_dbc);
+    BOOST_REQUIRE(other);
+    std::size_t n = net->messages().size();
+    net->merge(std::move(other));
+    BOOST_REQUIRE_EQUAL(net->messages().size(), n + 1);
+    check_ranges(*net);
+}
+
+BOOST_AUTO_TEST_CASE(SignalIndex)
+{
+    BOOST_TEST_MESSAGE("Testing the signal indices...");
+
+    std::ifstream dbc_file(TEST_DBC);
+    auto net = dbcppp::Network::fromDBC(dbc_file);
+    BOOST_REQUIRE(net);
+    std::size_t global_index = 0;
+    uint64_t last_id = 0;
+    for (const dbcppp::Message& msg : net->messages())
+    {
+        BOOST_REQUIRE(global_index == 0 || msg.getId() > last_id);
+        last_id = msg.getId();
+        BOOST_REQUIRE_EQUAL(msg.signalCount(), msg.signals().size());
+        BOOST_REQUIRE(msg.getSignalByIndex(msg.signalCount()) == nullptr);
+        uint64_t last_start_bit = 0;
+        for (std::size_t i = 0; i < msg.signalCount(); i++)
+        {
+            const dbcppp::Signal* sig = msg.getSignalByIndex(i);
+            BOOST_REQUIRE_EQUAL(sig, &msg.signals()[i]);
+            BOOST_REQUIRE_EQUAL(sig->getIndex(), i);
+            BOOST_REQUIRE_EQUAL(sig->getGlobalIndex(), global_index);
+            BOOST_REQUIRE_EQUAL(net->getSignalByGlobalIndex(global_index), sig);
+            BOOST_REQUIRE_EQUAL(msg.getSignalByName(sig->getName()), sig);
+            BOOST_REQUIRE_GE(sig->getStartBit(), last_start_bit);
+            last_start_bit = sig->getStartBit();
+
+            auto csig = reinterpret_cast<const dbcppp_Signal*>(sig);
+            auto cmsg = reinterpret_cast<const dbcppp_Message*>(&msg);
+            auto cnet = reinterpret_cast<const dbcppp_Network*>(net.get());
+            BOOST_REQUIRE_EQUAL(dbcppp_MessageGetSignalByIndex(cmsg, i), csig);
+            BOOST_REQUIRE_EQUAL(dbcppp_NetworkGetSignalByGlobalIndex(cnet, global_index), csig);
+            BOOST_REQUIRE_EQUAL(dbcppp_SignalGetIndex(csig), i);
+            BOOST_REQUIRE_EQUAL(dbcppp_SignalGetGlobalIndex(csig), global_index);
+            global_index++;
+        }
+    }
+    BOOST_REQUIRE_EQUAL(net->signalCount(), global_index);
+    BOOST_REQUIRE(net->getSignalByGlobalIndex(global_index) == nullptr);
+    BOOST_REQUIRE_EQUAL(dbcppp_NetworkSignalCount(reinterpret_cast<const dbcppp_Network*>(net.get())), global_index);
+}
+
+static void check_parents(const dbcppp::Network& net)
+{
+    for (const dbcppp::Message& msg : net.messages())
+    {
+        for (const dbcppp::Signal& sig : msg.signals())
+        {
+            BOOST_REQUIRE_EQUAL(net.findParentMessage(&sig), &msg);
+        }
+    }
+}
+BOOST_AUTO_TEST_CASE(FindParentMessage)
+{
+    BOOST_TEST_MESSAGE("Testing Network::findParentMessage...");
+
+    std::ifstream dbc_file(TEST_DBC);
+    auto net = dbcppp::Network::fromDBC(dbc_file);
+    BOOST_REQUIRE(net);
+    check_parents(*net);
+    auto copy = net->clone();
+    check_parents(*copy);
+    // signals of another network don't have a parent in this one
+    BOOST_REQUIRE(net->findParentMessage(&copy->messages()[0].signals()[0]) == nullptr);
+
+    // merging many messages makes the message map relocate its values
+    std::ostringstream ss;
+    ss << "VERSION \"\"\nNS_ :\nBS_:\nBU_:\n";
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        ss << "BO_ " << 1000 + i << " m" << i << ": 8 Vector__XXX\n"
+            << " SG_ s" << i << " : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n";
+    }
+    std::istringstream other_dbc(ss.str());
+    auto other = dbcppp::Network::fromDBC(other_dbc);
+    BOOST_REQUIRE(other);
+    net->merge(std::move(other));
+    check_parents(*net);
+}
+
+BOOST_AUTO_TEST_CASE(QualifiedName)
+{
+    BOOST_TEST_MESSAGE("Testing Network::getSignalByQualifiedName...");
+
+    std::istringstream dbc0(
+        "VERSION \"\"\nNS_ :\nBS_:\nBU_:\n"
+        "BO_ 1 m0: 8 Vector__XXX\n"
+        " SG_ a : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ b : 8|8@1+ (1,0) [0|0] \"\" Vector__XXX\n");
+    std::istringstream dbc1(
+        "VERSION \"\"\nNS_ :\nBS_:\nBU_:\n"
+        "BO_ 2 m1: 8 Vector__XXX\n"
+        " SG_ a : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ c : 8|8@1+ (1,0) [0|0] \"\" Vector__XXX\n");
+    auto net = dbcppp::Network::fromDBC(dbc0);
+    auto net1 = dbcppp::Network::fromDBC(dbc1);
+    BOOST_REQUIRE(net && net1);
+    net->merge(std::move(net1), "bus1");
+    const dbcppp::Message* m0 = net->getMessageById(1);
+    const dbcppp::Message* m1 = net->getMessageById(2);
+    BOOST_REQUIRE(m0 && m1);
+
+    BOOST_REQUIRE_EQUAL(net->getSignalByQualifiedName("m0.a"), m0->getSignalByName("a"));
+    BOOST_REQUIRE_EQUAL(net->getSignalByQualifiedName("m1.a"), m1->getSignalByName("a"));
+    BOOST_REQUIRE_EQUAL(net->getSignalByQualifiedName("bus1.m1.a"), m1->getSignalByName("a"));
+    BOOST_REQUIRE_EQUAL(net->getSignalByQualifiedName("b"), m0->getSignalByName("b"));
+    BOOST_REQUIRE_EQUAL(net->getSignalByQualifiedName("c"), m1->getSignalByName("c"));
+    // ambiguous and unknown names
+    BOOST_REQUIRE(net->getSignalByQualifiedName("a") == nullptr);
+    BOOST_REQUIRE(net->getSignalByQualifiedName("bus1.m0.a") == nullptr);
+    BOOST_REQUIRE(net->getSignalByQualifiedName("m0.c") == nullptr);
+
+    auto copy = net->clone();
+    auto resolved = copy->getSignalsByQualifiedNames({"m0.a", "x", "bus1.m1.c"});
+    BOOST_REQUIRE_EQUAL(resolved.size(), 3);
+    BOOST_REQUIRE_EQUAL(resolved[0], copy->getMessageById(1)->getSignalByName("a"));
+    BOOST_REQUIRE(resolved[1] == nullptr);
+    BOOST_REQUIRE_EQUAL(resolved[2], copy->getMessageById(2)->getSignalByName("c"));
+}
@@ -0,0 +1,144 @@
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cstring>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/RawPredicate.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+using Op = dbcppp::RawPredicate::Op;
+
+static std::unique_ptr<dbcppp::Signal> create_signal(uint64_t bit_size, dbcppp::Signal::ValueType value_type
+    , double factor, double offset, dbcppp::Signal::ExtendedValueType extended_value_type = dbcppp::Signal::ExtendedValueType::Integer
+    , std::unordered_map<int64_t, std::string>&& descs = {})
+{
+    return dbcppp::Signal::create(8, "s", dbcppp::Signal::Multiplexer::NoMux, 0, 0, bit_size
+        , dbcppp::Signal::ByteOrder::LittleEndian, value_type, factor, offset, 0, 0, ""
+        , {}, {}, std::move(descs), "", extended_value_type);
+}
+static bool expected(double phys, Op op, double value)
+{
+    switch (op)
+    {
+    case Op::Less: return phys < value;
+    case Op::LessEqual: return phys <= value;
+    case Op::Greater: return phys > value;
+    case Op::GreaterEqual: return phys >= value;
+    case Op::Equal: return phys == value;
+    case Op::NotEqual: return phys != value;
+    }
+    return false;
+}
+// raw values of the signal as decode returns them: all for small signals, random ones and the extremes for the wide ones
+static std::vector<uint64_t> raws(const dbcppp::Signal& sig, std::default_random_engine& rng)
+{
+    std::vector<uint64_t> result;
+    uint64_t n = sig.getBitSize();
+    uint64_t mask = n == 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+    auto extend = [&](uint64_t raw)
+    {
+        raw &= mask;
+        bool negative = sig.getValueType() == dbcppp::Signal::ValueType::Signed && (raw >> (n - 1)) & 1;
+        return negative ? raw | ~mask : raw;
+    };
+    if (n <= 10)
+    {
+        for (uint64_t raw = 0; raw <= mask; raw++)
+        {
+            result.push_back(extend(raw));
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<uint64_t> dist;
+        for (std::size_t i = 0; i < 1000; i++)
+        {
+            result.push_back(extend(dist(rng)));
+        }
+        for (uint64_t raw : {uint64_t(0), uint64_t(1), mask, mask >> 1, (mask >> 1) + 1})
+        {
+            result.push_back(extend(raw));
+        }
+    }
+    return result;
+}
+
+BOOST_AUTO_TEST_CASE(RawPredicate)
+{
+    BOOST_TEST_MESSAGE("Testing RawPredicate against comparing the physical values...");
+
+    using VT = dbcppp::Signal::ValueType;
+    std::default_random_engine rng(0);
+    std::vector<std::unique_ptr<dbcppp::Signal>> signals;
+    for (uint64_t bit_size : {1, 4, 8, 10, 16, 33, 64})
+    {
+        for (VT value_type : {VT::Unsigned, VT::Signed})
+        {
+            for (double factor : {1., 0.1, -0.25, 0., 3., -1e-3})
+            {
+                for (double offset : {0., -40., 7.5})
+                {
+                    signals.push_back(create_signal(bit_size, value_type, factor, offset));
+                }
+            }
+        }
+    }
+    signals.push_back(create_signal(32, VT::Signed, 1, 0, dbcppp::Signal::ExtendedValueType::Float));
+    signals.push_back(create_signal(64, VT::Signed, 0.5, 1, dbcppp::Signal::ExtendedValueType::Double));
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    for (const auto& sig : signals)
+    {
+        BOOST_REQUIRE_EQUAL(dbcppp::RawPredicate::create(*sig, Op::Less, 0).isRawDomain(),
+            sig->getExtendedValueType() == dbcppp::Signal::ExtendedValueType::Integer);
+        std::vector<uint64_t> rs = raws(*sig, rng);
+        // thresholds on, between and beyond the physical values
+        std::vector<double> thresholds = {0., -0., 1e300, -1e300, inf, -inf, std::nan("")};
+        for (std::size_t i = 0; i < 5; i++)
+        {
+            double phys = sig->rawToPhys(rs[rng() % rs.size()]);
+            thresholds.push_back(phys);
+            thresholds.push_back(std::nextafter(phys, inf));
+            thresholds.push_back(std::nextafter(phys, -inf));
+        }
+        bool equal = true;
+        for (double threshold : thresholds)
+        {
+            for (Op op : {Op::Less, Op::LessEqual, Op::Greater, Op::GreaterEqual, Op::Equal, Op::NotEqual})
+            {
+                auto pred = dbcppp::RawPredicate::create(*sig, op, threshold);
+                auto inverse = !pred;
+                for (uint64_t raw : rs)
+                {
+                    bool e = expected(sig->rawToPhys(raw), op, threshold);
+                    equal = equal && pred(raw) == e && inverse(raw) != e;
+                }
+            }
+            double upper = thresholds[rng() % thresholds.size()];
+            auto range = dbcppp::RawPredicate::inRange(*sig, threshold, upper);
+            for (uint64_t raw : rs)
+            {
+                double phys = sig->rawToPhys(raw);
+                equal = equal && range(raw) == (threshold <= phys && phys <= upper);
+            }
+        }
+        BOOST_REQUIRE(equal);
+    }
+
+    auto gear = create_signal(4, VT::Unsigned, 1, 0, dbcppp::Signal::ExtendedValueType::Integer,
+        {{0, "Park"}, {1, "Reverse"}, {2, "Neutral"}, {3, "Drive"}, {7, "Invalid"}, {8, "Invalid"}, {15, "Invalid"}});
+    auto reverse = dbcppp::RawPredicate::hasLabel(*gear, "Reverse");
+    auto invalid = dbcppp::RawPredicate::hasLabel(*gear, "Invalid");
+    auto unknown = dbcppp::RawPredicate::hasLabel(*gear, "Sport");
+    for (uint64_t raw = 0; raw < 16; raw++)
+    {
+        BOOST_REQUIRE_EQUAL(reverse(raw), raw == 1);
+        BOOST_REQUIRE_EQUAL(invalid(raw), raw == 7 || raw == 8 || raw == 15);
+        BOOST_REQUIRE_EQUAL((!invalid)(raw), !(raw == 7 || raw == 8 || raw == 15));
+        BOOST_REQUIRE(!unknown(raw));
+    }
+}
@@ -0,0 +1,120 @@
+
+#include <cstring>
+#include <sstream>
+#include <fstream>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/SharedSignalTable.h"
+#include "Config.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <sys/wait.h>
+
+// runs in the forked reader process, returns the exit code
+static int read_table(const std::string& name, uint64_t layout_hash)
+{
+    auto table = dbcppp::SharedSignalTable::open(name);
+    if (!table || table->isWriter() || table->getLayoutHash() != layout_hash)
+    {
+        return 1;
+    }
+    std::size_t msg = table->findMessage(2);
+    std::size_t s3 = table->findSignal("m1", "s3");
+    if (msg == dbcppp::SharedSignalTable::npos || s3 == dbcppp::SharedSignalTable::npos ||
+        std::strcmp(table->getMessageName(msg), "m1") != 0 || table->getSignalMessage(s3) != msg)
+    {
+        return 2;
+    }
+    // the writer keeps updating with frames which have all bytes equal, until this process exits
+    dbcppp::SharedSignalTable::Value values[4];
+    uint64_t last_update = 0;
+    std::size_t n_updates = 0;
+    while (n_updates < 1000)
+    {
+        uint64_t update = table->snapshot(msg, values);
+        if (update < last_update)
+        {
+            return 3;
+        }
+        if (update == 0 || update == last_update)
+        {
+            continue;
+        }
+        for (std::size_t i = 0; i < table->getMessageSignalCount(msg); i++)
+        {
+            uint64_t byte = values[0].raw;
+            if (values[i].update != update || values[i].timestamp != values[0].timestamp ||
+                values[i].raw != (byte * 0x0101010101010101ull) >> (64 - 8 * (i == 2 ? 4 : 1)) ||
+                values[i].phys != double(values[i].raw) * 0.5)
+            {
+                return 4;
+            }
+        }
+        last_update = update;
+        n_updates++;
+    }
+    dbcppp::SharedSignalTable::Value value;
+    table->load(s3, value);
+    if (value.update == 0)
+    {
+        return 5;
+    }
+    return 0;
+}
+BOOST_AUTO_TEST_CASE(SharedSignalTable)
+{
+    BOOST_TEST_MESSAGE("Testing SharedSignalTable with a reader process...");
+
+    std::istringstream dbc(
+        "VERSION \"\"\nNS_ :\nBS_:\nBU_:\n"
+        "BO_ 1 m0: 8 Vector__XXX\n"
+        " SG_ s0 : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "BO_ 2 m1: 8 Vector__XXX\n"
+        " SG_ s0 : 0|8@1+ (0.5,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ s1 : 8|8@1+ (0.5,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ s2 : 16|32@1+ (0.5,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ s3 : 48|8@1+ (0.5,0) [0|0] \"\" Vector__XXX\n"
+        "BO_ 3 m2: 8 Vector__XXX\n");
+    auto net = dbcppp::Network::fromDBC(dbc);
+    BOOST_REQUIRE(net);
+    std::string name = "/dbcppp_test_" + std::to_string(getpid());
+    auto table = dbcppp::SharedSignalTable::create(name, *net);
+    BOOST_REQUIRE(table);
+    BOOST_REQUIRE(table->isWriter());
+    BOOST_REQUIRE_EQUAL(table->messageCount(), 3);
+    BOOST_REQUIRE_EQUAL(table->signalCount(), 5);
+    BOOST_REQUIRE_EQUAL(table->getMessageSignalCount(table->findMessage(3)), 0);
+    BOOST_REQUIRE_EQUAL(table->findSignal("m1", "s4"), dbcppp::SharedSignalTable::npos);
+    BOOST_REQUIRE_EQUAL(table->findSignal("m0", "s0"), net->getMessageById(1)->getSignalByName("s0")->getGlobalIndex());
+
+    pid_t pid = fork();
+    BOOST_REQUIRE_GE(pid, 0);
+    if (pid == 0)
+    {
+        _exit(read_table(name, table->getLayoutHash()));
+    }
+    dbcppp::Frame frame{};
+    frame.size = 8;
+    int status = 0;
+    for (uint64_t i = 0; waitpid(pid, &status, WNOHANG) == 0; i++)
+    {
+        frame.id = uint32_t(1 + i % 2);
+        frame.timestamp = i;
+        std::memset(frame.data, int(i & 0xFF), 8);
+        table->update(frame);
+    }
+    BOOST_REQUIRE(WIFEXITED(status));
+    BOOST_REQUIRE_EQUAL(WEXITSTATUS(status), 0);
+
+    auto reader = dbcppp::SharedSignalTable::open(name);
+    BOOST_REQUIRE(reader);
+    BOOST_REQUIRE(reader->isWriterAlive());
+    table.reset();
+    BOOST_REQUIRE(!reader->isWriterAlive());
+    BOOST_REQUIRE(dbcppp::SharedSignalTable::open(name) == nullptr);
+}
+#endif
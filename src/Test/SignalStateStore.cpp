@@ -0,0 +1,137 @@
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <sstream>
+#include <fstream>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/SignalStateStore.h"
+#include "Config.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+BOOST_AUTO_TEST_CASE(SignalStateStore)
+{
+    BOOST_TEST_MESSAGE("Testing SignalStateStore...");
+
+    std::ifstream dbc_file(TEST_DBC);
+    auto net = dbcppp::Network::fromDBC(dbc_file);
+    BOOST_REQUIRE(net);
+    auto store = dbcppp::SignalStateStore::create(*net);
+    const dbcppp::Message* msg = net->getMessageById(1);
+    BOOST_REQUIRE(msg && msg->getMuxSignal());
+    std::vector<dbcppp::SignalStateStore::Value> values(msg->signalCount());
+    BOOST_REQUIRE_EQUAL(store->snapshot(*msg, values.data()), 0);
+    for (const auto& value : values)
+    {
+        BOOST_REQUIRE_EQUAL(value.update, 0);
+    }
+
+    dbcppp::Frame frame{};
+    frame.id = 1;
+    frame.size = 8;
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        frame.data[i] = uint8_t(0x35 * i + 0x10);
+    }
+    for (uint8_t mux : {0, 1, 0})
+    {
+        frame.data[0] = uint8_t((frame.data[0] & ~7) | mux);
+        frame.timestamp += 10;
+        BOOST_REQUIRE(store->update(frame));
+        uint64_t update = store->snapshot(*msg, values.data());
+        BOOST_REQUIRE_EQUAL(update, frame.timestamp / 10);
+        for (std::size_t i = 0; i < msg->signalCount(); i++)
+        {
+            const dbcppp::Signal& sig = *msg->getSignalByIndex(i);
+            if (sig.getMultiplexerIndicator() == dbcppp::Signal::Multiplexer::MuxValue && sig.getMultiplexerSwitchValue() != mux)
+            {
+                // inactive signals keep the value of an older update, if there was one
+                BOOST_REQUIRE_LT(values[i].update, update);
+                continue;
+            }
+            BOOST_REQUIRE_EQUAL(values[i].update, update);
+            BOOST_REQUIRE_EQUAL(values[i].timestamp, frame.timestamp);
+            BOOST_REQUIRE_EQUAL(values[i].raw, sig.decode(frame.data));
+            BOOST_REQUIRE_EQUAL(values[i].phys, sig.rawToPhys(values[i].raw));
+            dbcppp::SignalStateStore::Value value;
+            BOOST_REQUIRE_EQUAL(store->load(sig, value), update);
+            BOOST_REQUIRE_EQUAL(value.raw, values[i].raw);
+        }
+    }
+    frame.id = 12345;
+    BOOST_REQUIRE(!store->update(frame));
+}
+BOOST_AUTO_TEST_CASE(SignalStateStoreConcurrent)
+{
+    BOOST_TEST_MESSAGE("Testing SignalStateStore snapshots while writers update the messages...");
+
+    // the frames have all bytes equal, so a consistent snapshot has all values equal
+    std::istringstream dbc(
+        "VERSION \"\"\nNS_ :\nBS_:\nBU_:\n"
+        "BO_ 1 m0: 8 Vector__XXX\n"
+        " SG_ s0 : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ s1 : 8|16@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ s2 : 24|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ s3 : 32|32@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "BO_ 2 m1: 8 Vector__XXX\n"
+        " SG_ s0 : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ s1 : 8|8@1+ (1,0) [0|0] \"\" Vector__XXX\n");
+    auto net = dbcppp::Network::fromDBC(dbc);
+    BOOST_REQUIRE(net);
+    auto store = dbcppp::SignalStateStore::create(*net);
+
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> writers;
+    for (uint32_t w = 0; w < 3; w++)
+    {
+        writers.emplace_back(
+            [&, w]
+            {
+                dbcppp::Frame frame{};
+                frame.size = 8;
+                for (uint64_t i = 0; !stop; i++)
+                {
+                    frame.id = uint32_t(1 + i % 2);
+                    frame.timestamp = i * 3 + w;
+                    std::memset(frame.data, int(frame.timestamp & 0xFF), 8);
+                    store->update(frame);
+                }
+            });
+    }
+    bool consistent[2] = {true, true};
+    std::vector<std::thread> readers;
+    for (std::size_t r = 0; r < 2; r++)
+    {
+        readers.emplace_back(
+            [&, r]
+            {
+                dbcppp::SignalStateStore::Value values[4];
+                for (std::size_t i = 0; i < 100000; i++)
+                {
+                    const dbcppp::Message& msg = *net->getMessageById(1 + i % 2);
+                    uint64_t update = store->snapshot(msg, values);
+                    for (std::size_t j = 0; update && j < msg.signalCount(); j++)
+                    {
+                        uint64_t byte = values[0].raw;
+                        uint64_t expected = (byte * 0x0101010101010101ull) >> (64 - msg.getSignalByIndex(j)->getBitSize());
+                        consistent[r] = consistent[r] && values[j].update == update &&
+                            values[j].timestamp == values[0].timestamp && values[j].raw == expected;
+                    }
+                }
+            });
+    }
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    stop = true;
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+    BOOST_REQUIRE(consistent[0] && consistent[1]);
+}
@@ -0,0 +1,113 @@
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <vector>
+#include <fstream>
+
+#include "../../include/dbcppp/Network.h"
+#include "../../include/dbcppp/SignalStatistics.h"
+#include "Config.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+BOOST_AUTO_TEST_CASE(SignalStatistics)
+{
+    BOOST_TEST_MESSAGE("Testing SignalStatistics against aggregating the decoded values...");
+
+    std::ifstream dbc_file(TEST_DBC);
+    auto net = dbcppp::Network::fromDBC(dbc_file);
+    BOOST_REQUIRE(net);
+
+    std::default_random_engine rng(0);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<dbcppp::Frame> frames(3000);
+    for (std::size_t i = 0; i < frames.size(); i++)
+    {
+        auto& frame = frames[i];
+        frame.id = uint32_t(dist(rng) % 3);
+        frame.size = 8;
+        // 10 frames per window on average, with a gap of empty windows
+        frame.timestamp = 1000 + i * 100 + (i > 1500 ? 50000 : 0);
+        for (auto& b : frame.data)
+        {
+            b = uint8_t(dist(rng));
+        }
+    }
+    // the values per window and signal
+    const uint64_t window = 1000;
+    std::map<std::pair<uint64_t, const dbcppp::Signal*>, std::vector<std::pair<uint64_t, double>>> expected;
+    for (const auto& frame : frames)
+    {
+        const dbcppp::Message* msg = net->getMessageById(frame.id);
+        if (!msg)
+        {
+            continue;
+        }
+        const dbcppp::Signal* mux_sig = msg->getMuxSignal();
+        for (const dbcppp::Signal& sig : msg->signals())
+        {
+            if (sig.getMultiplexerIndicator() != dbcppp::Signal::Multiplexer::MuxValue ||
+                mux_sig && sig.getMultiplexerSwitchValue() == mux_sig->decode(frame.data))
+            {
+                double phys = sig.rawToPhys(sig.decode(frame.data));
+                if (!std::isnan(phys))
+                {
+                    expected[std::make_pair(frame.timestamp / window * window, &sig)].emplace_back(frame.timestamp, phys);
+                }
+            }
+        }
+    }
+
+    std::size_t n_aggregates = 0;
+    uint64_t last_window = 0;
+    bool equal = true;
+    auto stats = dbcppp::SignalStatistics::create(*net, window,
+        [&](uint64_t window_start, const dbcppp::SignalStatistics::Aggregate* aggregates, std::size_t n)
+        {
+            equal = equal && window_start > last_window;
+            last_window = window_start;
+            for (std::size_t i = 0; i < n; i++)
+            {
+                const auto& a = aggregates[i];
+                auto iter = expected.find(std::make_pair(window_start, a.signal));
+                if (iter == expected.end())
+                {
+                    equal = false;
+                    continue;
+                }
+                const auto& values = iter->second;
+                double min = values[0].second;
+                double max = values[0].second;
+                double sum = 0.;
+                for (const auto& v : values)
+                {
+                    min = std::min(min, v.second);
+                    max = std::max(max, v.second);
+                    sum += v.second;
+                }
+                double mean = sum / values.size();
+                double sq = 0.;
+                for (const auto& v : values)
+                {
+                    sq += (v.second - mean) * (v.second - mean);
+                }
+                double variance = sq / values.size();
+                double scale = std::max({std::abs(min), std::abs(max), 1.});
+                equal = equal && a.count == values.size() && a.min == min && a.max == max &&
+                    a.last == values.back().second && a.last_timestamp == values.back().first &&
+                    std::abs(a.mean - mean) <= 1e-9 * scale &&
+                    // the squares of the huge values of the float signals overflow
+                    (!std::isfinite(variance) || std::abs(a.variance - variance) <= 1e-9 * scale * scale);
+                n_aggregates++;
+            }
+        });
+    BOOST_REQUIRE_EQUAL(stats->getWindow(), window);
+    stats->add(&frames[0], 1000);
+    stats->add(&frames[1000], frames.size() - 1000);
+    stats->flush();
+    stats->flush();
+    BOOST_REQUIRE(equal);
+    BOOST_REQUIRE_EQUAL(n_aggregates, expected.size());
+}
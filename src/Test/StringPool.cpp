@@ -0,0 +1,67 @@
+
+#include <vector>
+#include <sstream>
+
+#include "../../include/dbcppp/Network.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+BOOST_AUTO_TEST_CASE(StringPool)
+{
+    BOOST_TEST_MESSAGE("Testing the interned node and attribute names...");
+
+    std::istringstream dbc(
+        "VERSION \"\"\nNS_ :\nBS_:\nBU_: A B C\n"
+        "BO_ 1 m0: 8 A\n"
+        " SG_ s0 : 0|8@1+ (1,0) [0|0] \"\" C,A\n"
+        " SG_ s1 : 8|8@1+ (1,0) [0|0] \"\" B\n"
+        "BO_TX_BU_ 1 : B,A;\n"
+        "BA_DEF_ SG_ \"b_attr\" STRING;\n"
+        "BA_DEF_ SG_ \"a_attr\" STRING;\n"
+        "BA_DEF_DEF_ \"b_attr\" \"\";\n"
+        "BA_DEF_DEF_ \"a_attr\" \"\";\n"
+        "BA_ \"b_attr\" SG_ 1 s0 \"v1\";\n"
+        "BA_ \"a_attr\" SG_ 1 s0 \"v2\";\n"
+        "BA_ \"b_attr\" SG_ 1 s1 \"v3\";\n");
+    auto net = dbcppp::Network::fromDBC(dbc);
+    BOOST_REQUIRE(net);
+    const dbcppp::Message* msg = net->getMessageById(1);
+    BOOST_REQUIRE(msg);
+    const dbcppp::Signal* s0 = msg->getSignalByName("s0");
+    const dbcppp::Signal* s1 = msg->getSignalByName("s1");
+    BOOST_REQUIRE(s0 && s1);
+
+    std::vector<std::string> receivers;
+    s0->forEachReceiver(
+        [&](const std::string& name)
+        {
+            receivers.push_back(name);
+        });
+    BOOST_REQUIRE(receivers == std::vector<std::string>({"A", "C"}));
+    BOOST_REQUIRE(s0->hasReceiver("A") && s0->hasReceiver("C") && !s0->hasReceiver("B"));
+    BOOST_REQUIRE(msg->hasMessageTransmitter("A") && msg->hasMessageTransmitter("B"));
+    BOOST_REQUIRE(!msg->hasMessageTransmitter("C"));
+
+    const dbcppp::Attribute* a = s0->getAttributeValueByName("a_attr");
+    const dbcppp::Attribute* b0 = s0->getAttributeValueByName("b_attr");
+    const dbcppp::Attribute* b1 = s1->getAttributeValueByName("b_attr");
+    BOOST_REQUIRE(a && b0 && b1);
+    BOOST_REQUIRE(s1->getAttributeValueByName("a_attr") == nullptr);
+    BOOST_REQUIRE_EQUAL(boost::get<std::string>(a->getValue()), "v2");
+    BOOST_REQUIRE_EQUAL(boost::get<std::string>(b0->getValue()), "v1");
+    BOOST_REQUIRE_EQUAL(boost::get<std::string>(b1->getValue()), "v3");
+    std::vector<std::string> names;
+    s0->forEachAttributeValue(
+        [&](const dbcppp::Attribute& attr)
+        {
+            names.push_back(attr.getName());
+        });
+    BOOST_REQUIRE(names == std::vector<std::string>({"a_attr", "b_attr"}));
+    // equal names share their storage, also across copies of the network
+    BOOST_REQUIRE_EQUAL(&b0->getName(), &b1->getName());
+    auto copy = net->clone();
+    const dbcppp::Attribute* b_copy = copy->getMessageById(1)->getSignalByName("s1")->getAttributeValueByName("b_attr");
+    BOOST_REQUIRE(b_copy);
+    BOOST_REQUIRE_EQUAL(&b_copy->getName(), &b0->getName());
+}
@@ -0,0 +1,128 @@
+
+#include <limits>
+#include <vector>
+#include <sstream>
+
+#include "../../include/dbcppp/Network.h"
+
+#include <boost/test/unit_test.hpp>
+namespace utf = boost::unit_test;
+
+BOOST_AUTO_TEST_CASE(SharedValueDescriptions)
+{
+    BOOST_TEST_MESSAGE("Testing the sharing of equal value description tables...");
+
+    std::istringstream dbc(
+        "VERSION \"\"\nNS_ :\nBS_:\nBU_:\n"
+        "VAL_TABLE_ state 2 \"Error\" 1 \"On\" 0 \"Off\" ;\n"
+        "BO_ 1 m0: 8 Vector__XXX\n"
+        " SG_ s0 : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ s1 : 8|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        " SG_ s2 : 16|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "BO_ 2 m1: 8 Vector__XXX\n"
+        " SG_ s3 : 0|8@1+ (1,0) [0|0] \"\" Vector__XXX\n"
+        "VAL_ 1 s0 0 \"Off\" 1 \"On\" 2 \"Error\" ;\n"
+        "VAL_ 1 s1 0 \"Off\" 1 \"On\" 2 \"SNA\" ;\n"
+        "VAL_ 2 s3 2 \"Error\" 1 \"On\" 0 \"Off\" ;\n");
+    auto net = dbcppp::Network::fromDBC(dbc);
+    BOOST_REQUIRE(net);
+    const dbcppp::Signal* s0 = net->getMessageById(1)->getSignalByName("s0");
+    const dbcppp::Signal* s1 = net->getMessageById(1)->getSignalByName("s1");
+    const dbcppp::Signal* s2 = net->getMessageById(1)->getSignalByName("s2");
+    const dbcppp::Signal* s3 = net->getMessageById(2)->getSignalByName("s3");
+    const dbcppp::ValueTable* vt = net->getValueTableByName("state");
+    BOOST_REQUIRE(s0 && s1 && s2 && s3 && vt);
+
+    BOOST_REQUIRE(s0->getValueDescriptionByValue(2));
+    BOOST_REQUIRE_EQUAL(*s0->getValueDescriptionByValue(2), "Error");
+    BOOST_REQUIRE_EQUAL(*s1->getValueDescriptionByValue(2), "SNA");
+    BOOST_REQUIRE(s0->getValueDescriptionByValue(3) == nullptr);
+    BOOST_REQUIRE(s2->getValueDescriptionByValue(0) == nullptr);
+    // equal tables are one instance, no matter where they come from
+    BOOST_REQUIRE_EQUAL(s0->getValueDescriptionByValue(0), s3->getValueDescriptionByValue(0));
+    BOOST_REQUIRE_EQUAL(s0->getValueDescriptionByValue(0), vt->getvalueEncodingDescriptionByValue(0));
+    BOOST_REQUIRE_NE(s0->getValueDescriptionByValue(0), s1->getValueDescriptionByValue(0));
+    auto copy = net->clone();
+    BOOST_REQUIRE_EQUAL(s0->getValueDescriptionByValue(1),
+        copy->getMessageById(2)->getSignalByName("s3")->getValueDescriptionByValue(1));
+
+    std::size_t n = 0;
+    s1->forEachValueDescription(
+        [&](int64_t value, const std::string& desc)
+        {
+            BOOST_REQUIRE_EQUAL(*s1->getValueDescriptionByValue(value), desc);
+            n++;
+        });
+    BOOST_REQUIRE_EQUAL(n, 3);
+}
+
+static std::unique_ptr<dbcppp::Signal> create_signal(std::unordered_map<int64_t, std::string>&& descs)
+{
+    return dbcppp::Signal::create(8, "s", dbcppp::Signal::Multiplexer::NoMux, 0, 0, 64
+        , dbcppp::Signal::ByteOrder::LittleEndian, dbcppp::Signal::ValueType::Signed, 1, 0, 0, 0, ""
+        , {}, {}, std::move(descs), "", dbcppp::Signal::ExtendedValueType::Integer);
+}
+BOOST_AUTO_TEST_CASE(ValueDescriptionIds)
+{
+    BOOST_TEST_MESSAGE("Testing the value description lookup of the dense, sorted and hashed tables...");
+
+    std::vector<std::unordered_map<int64_t, std::string>> tables(4);
+    // dense, with holes and negative values
+    tables[0] = {{-2, "a"}, {-1, "b"}, {0, "c"}, {3, "d"}};
+    // few sparse values
+    tables[1] = {{1, "a"}, {100, "b"}, {10000, "c"}, {std::numeric_limits<int64_t>::min(), "min"}};
+    // many sparse values
+    for (int64_t i = 0; i < 100; i++)
+    {
+        tables[2][i * 1000 - 50000] = std::to_string(i);
+    }
+    tables[3][std::numeric_limits<int64_t>::max()] = "max";
+
+    std::vector<uint64_t> raws;
+    for (int64_t v = -60000; v <= 60000; v += 250)
+    {
+        raws.push_back(uint64_t(v));
+    }
+    for (int64_t v : {-3, -2, -1, 0, 1, 2, 3, 4, 100, 10000})
+    {
+        raws.push_back(uint64_t(v));
+    }
+    raws.push_back(uint64_t(std::numeric_limits<int64_t>::min()));
+    raws.push_back(uint64_t(std::numeric_limits<int64_t>::max()));
+    for (auto& table : tables)
+    {
+        auto expected = table;
+        auto sig = create_signal(std::move(table));
+        BOOST_REQUIRE_EQUAL(sig->valueDescriptionCount(), expected.size());
+        int64_t last = std::numeric_limits<int64_t>::min();
+        uint32_t id = 0;
+        sig->forEachValueDescription(
+            [&](int64_t value, const std::string& desc)
+            {
+                BOOST_REQUIRE(id == 0 || value > last);
+                BOOST_REQUIRE_EQUAL(*sig->getValueDescriptionById(id++), desc);
+                last = value;
+            });
+        BOOST_REQUIRE(sig->getValueDescriptionById(id) == nullptr);
+        BOOST_REQUIRE(sig->getValueDescriptionById(dbcppp::Signal::NoValueDescription) == nullptr);
+
+        std::vector<uint32_t> ids(raws.size());
+        sig->getValueDescriptionIds(raws.data(), raws.size(), ids.data());
+        for (std::size_t i = 0; i < raws.size(); i++)
+        {
+            auto iter = expected.find(int64_t(raws[i]));
+            const std::string* desc = sig->getValueDescriptionByValue(int64_t(raws[i]));
+            if (iter == expected.end())
+            {
+                BOOST_REQUIRE(desc == nullptr);
+                BOOST_REQUIRE_EQUAL(ids[i], dbcppp::Signal::NoValueDescription);
+            }
+            else
+            {
+                BOOST_REQUIRE(desc != nullptr);
+                BOOST_REQUIRE_EQUAL(*desc, iter->second);
+                BOOST_REQUIRE_EQUAL(sig->getValueDescriptionById(ids[i]), desc);
+            }
+        }
+    }
+}
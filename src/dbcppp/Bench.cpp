@@ -0,0 +1,261 @@
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <functional>
+
+#include "../../include/dbcppp/Network.h"
+#include "../libdbcppp/DBCAST2Network.h"
+#include "../libdbcppp/SignalImpl.h"
+#include "../Test/Generators.h"
+#include "Bench.h"
+
+namespace
+{
+    // keeps the compiler from optimizing the measured work away
+    volatile uint64_t sink;
+
+    struct Result
+    {
+        std::string name;
+        std::size_t iterations;
+        std::size_t ops;
+        double seconds;
+    };
+    // calls fn until at least min_seconds passed, fn returns the number of operations it did
+    Result measure(std::string name, const std::function<std::size_t()>& fn, double min_seconds = 0.2)
+    {
+        using clock = std::chrono::steady_clock;
+        Result result{std::move(name), 0, 0, 0.};
+        auto start = clock::now();
+        do
+        {
+            result.ops += fn();
+            result.iterations++;
+            result.seconds = std::chrono::duration<double>(clock::now() - start).count();
+        } while (result.seconds < min_seconds);
+        return result;
+    }
+    const char* alignment_name(dbcppp::Alignment alignment)
+    {
+        switch (alignment)
+        {
+        case dbcppp::Alignment::size_inbetween_first_64_bit: return "size_inbetween_first_64_bit";
+        case dbcppp::Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit: return "signal_exceeds_64_bit_size_but_signal_fits_into_64_bit";
+        case dbcppp::Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit: return "signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit";
+        }
+        return "";
+    }
+    std::string escape(const std::string& str)
+    {
+        std::string result;
+        for (char c : str)
+        {
+            if (c == '"' || c == '\\')
+            {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result;
+    }
+}
+
+int run_bench(
+      const std::string& dbc_filename
+    , std::size_t n_messages
+    , std::size_t n_frames
+    , uint32_t seed
+    , std::ostream& os)
+{
+    using namespace dbcppp;
+
+    std::default_random_engine rng(seed);
+    std::uniform_int_distribution<std::mt19937::result_type> dist(0, -1);
+    std::string dbc;
+    if (dbc_filename.empty())
+    {
+        dbc = generate_random_dbc(n_messages, 8, rng);
+    }
+    else
+    {
+        std::ifstream is(dbc_filename);
+        if (!is.is_open())
+        {
+            std::cout << "Error! Couldn't open \"" << dbc_filename << "\"" << std::endl;
+            return 1;
+        }
+        dbc.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    }
+    std::vector<Result> results;
+
+    // parse phases
+    G_Network gnet;
+    {
+        auto begin{dbc.begin()}, end{dbc.end()};
+        NetworkGrammar<std::string::iterator> g(begin);
+        if (!phrase_parse(begin, end, g, boost::spirit::ascii::space, gnet) || begin != end)
+        {
+            std::cout << "Error! Couldn't parse the DBC" << std::endl;
+            return 1;
+        }
+    }
+    results.push_back(measure("parse",
+        [&]
+        {
+            auto begin{dbc.begin()}, end{dbc.end()};
+            NetworkGrammar<std::string::iterator> g(begin);
+            G_Network gn;
+            phrase_parse(begin, end, g, boost::spirit::ascii::space, gn);
+            return std::size_t(1);
+        }));
+    results.push_back(measure("dbcast2network",
+        [&]
+        {
+            sink = sink + (DBCAST2Network(gnet) != nullptr);
+            return std::size_t(1);
+        }));
+    results.push_back(measure("from_dbc",
+        [&]
+        {
+            std::istringstream is(dbc);
+            sink = sink + (Network::fromDBC(is) != nullptr);
+            return std::size_t(1);
+        }));
+    auto net = DBCAST2Network(gnet);
+
+    // random traffic of the messages of the network
+    std::vector<const Message*> messages;
+    std::vector<const Signal*> signals;
+    std::vector<const Signal*> signals_by_alignment[3];
+    net->forEachMessage(
+        [&](const Message& msg)
+        {
+            messages.push_back(&msg);
+            msg.forEachSignal(
+                [&](const Signal& sig)
+                {
+                    signals.push_back(&sig);
+                    signals_by_alignment[std::size_t(static_cast<const SignalImpl&>(sig)._alignment)].push_back(&sig);
+                });
+        });
+    if (messages.empty() || signals.empty())
+    {
+        std::cout << "Error! The DBC doesn't contain any signals" << std::endl;
+        return 1;
+    }
+    struct RandomFrame
+    {
+        uint64_t id;
+        alignas(8) uint8_t data[64];
+    };
+    std::vector<RandomFrame> frames(n_frames ? n_frames : 1);
+    for (auto& frame : frames)
+    {
+        frame.id = messages[dist(rng) % messages.size()]->getId();
+        for (auto& b : frame.data)
+        {
+            b = uint8_t(dist(rng));
+        }
+    }
+    // the per signal phases only use a few frames, so they measure the decode function and not the memory bandwidth
+    const std::size_t n_data = frames.size() < 64 ? frames.size() : 64;
+
+    results.push_back(measure("lookup",
+        [&]
+        {
+            uint64_t found = 0;
+            for (const auto& frame : frames)
+            {
+                found += net->getMessageById(frame.id) != nullptr;
+            }
+            sink = sink + found;
+            return frames.size();
+        }));
+    for (std::size_t a = 0; a < 3; a++)
+    {
+        const auto& sigs = signals_by_alignment[a];
+        if (sigs.empty())
+        {
+            continue;
+        }
+        results.push_back(measure(std::string("decode/") + alignment_name(Alignment(a)),
+            [&]
+            {
+                uint64_t sum = 0;
+                for (std::size_t i = 0; i < n_data; i++)
+                {
+                    for (const Signal* sig : sigs)
+                    {
+                        sum += sig->decode(frames[i].data);
+                    }
+                }
+                sink = sink + sum;
+                return n_data * sigs.size();
+            }));
+    }
+    std::vector<Signal::raw_t> raws;
+    for (const Signal* sig : signals)
+    {
+        raws.push_back(sig->decode(frames[0].data));
+    }
+    results.push_back(measure("encode",
+        [&]
+        {
+            alignas(8) uint8_t buffer[64] = {};
+            for (std::size_t i = 0; i < signals.size(); i++)
+            {
+                signals[i]->encode(raws[i], buffer);
+            }
+            sink = sink + buffer[0];
+            return signals.size();
+        }));
+    results.push_back(measure("raw_to_phys",
+        [&]
+        {
+            double sum = 0.;
+            for (std::size_t i = 0; i < signals.size(); i++)
+            {
+                sum += signals[i]->rawToPhys(raws[i]);
+            }
+            sink = sink + uint64_t(sum == 0.);
+            return signals.size();
+        }));
+    results.push_back(measure("decode_frames",
+        [&]
+        {
+            double sum = 0.;
+            for (const auto& frame : frames)
+            {
+                const Message* msg = net->getMessageById(frame.id);
+                for (const Signal& sig : msg->signals())
+                {
+                    sum += sig.rawToPhys(sig.decode(frame.data));
+                }
+            }
+            sink = sink + uint64_t(sum == 0.);
+            return frames.size();
+        }));
+
+    os << "{\n"
+        << "  \"dbc\": \"" << escape(dbc_filename.empty() ? "generated" : dbc_filename) << "\",\n"
+        << "  \"messages\": " << messages.size() << ",\n"
+        << "  \"signals\": " << signals.size() << ",\n"
+        << "  \"frames\": " << frames.size() << ",\n"
+        << "  \"seed\": " << seed << ",\n"
+        << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); i++)
+    {
+        const auto& r = results[i];
+        os << "    {\"name\": \"" << r.name << "\", \"iterations\": " << r.iterations
+            << ", \"ops\": " << r.ops << ", \"seconds\": " << r.seconds
+            << ", \"ns_per_op\": " << r.seconds * 1e9 / double(r.ops)
+            << ", \"ops_per_second\": " << double(r.ops) / r.seconds << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    os << "  ]\n}\n";
+    return 0;
+}
@@ -0,0 +1,16 @@
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+
+// runs the `dbcppp bench` phases and writes the results as JSON to os,
+// a DBC with n_messages random messages is generated if dbc_filename is empty
+int run_bench(
+      const std::string& dbc_filename
+    , std::size_t n_messages
+    , std::size_t n_frames
+    , uint32_t seed
+    , std::ostream& os);
@@ -1,10 +1,9 @@
 
-#include <regex>
-#include <array>
 #include <string>
 #include <vector>
 #include <fstream>
 #include <sstream>
+#include <iomanip>
 #include <iostream>
 #include <filesystem>
 #include <boost/program_options.hpp>
@@ -12,12 +11,183 @@
 #include <robin-map/tsl/robin_map.h>
 #include "../../include/dbcppp/Network.h"
 #include "../../include/dbcppp/Network2Functions.h"
+#include "../../include/dbcppp/SocketCAN.h"
+#include "../../include/dbcppp/FrameSource.h"
+#include "../../include/dbcppp/SignalStatistics.h"
+#include "Bench.h"
+
+#ifdef __linux__
+#include <poll.h>
+#endif
 
 void print_help()
 {
     std::cout << "dbcppp v1.0.0\nFor help type: dbcppp <subprogram> --help\n"
-        << "Sub programs: dbc2, decode\n";
+        << "Sub programs: dbc2, decode, bench\n";
+}
+struct Bus
+{
+    std::string name;
+    std::unique_ptr<dbcppp::Network> net;
+    std::unique_ptr<dbcppp::SignalStatistics> stats;
+};
+Bus parse_bus(const std::string& opt_bus)
+{
+    std::istringstream ss(opt_bus);
+    std::string opt;
+    Bus b;
+    if (std::getline(ss, opt, ','))
+    {
+        b.name = opt;
+    }
+    else
+    {
+        // TODO error
+    }
+    if (std::getline(ss, opt))
+    {
+        std::ifstream fdbc(opt);
+        b.net = dbcppp::Network::fromDBC(fdbc);
+    }
+    else
+    {
+        // TODO error
+    }
+    return b;
+}
+void print_signals(const dbcppp::Message& msg, const uint8_t* data)
+{
+    std::cout << msg.getName() << "(";
+    bool first = true;
+    const auto* mux_sig = msg.getMuxSignal();
+    for (const dbcppp::Signal& sig : msg.signals())
+    {
+        if (sig.getMultiplexerIndicator() != dbcppp::Signal::Multiplexer::MuxValue ||
+            mux_sig && sig.getMultiplexerSwitchValue() == mux_sig->decode(data))
+        {
+            if (first) first = false; else std::cout << ", ";
+            auto raw = sig.decode(data);
+            auto desc = sig.getValueDescriptionByValue(raw);
+            if (desc != nullptr)
+            {
+                std::cout << sig.getName() << ": " << *desc << " " << sig.getUnit();
+            }
+            else
+            {
+                auto val = sig.rawToPhys(raw);
+                std::cout << sig.getName() << ": " << val << " " << sig.getUnit();
+            }
+        }
+    }
+    std::cout << ")\n";
+}
+void print_statistics(const std::string& bus_name, const std::vector<const dbcppp::Message*>& messages, uint64_t window_start, const dbcppp::SignalStatistics::Aggregate* aggregates, std::size_t n)
+{
+    std::cout << "(" << window_start / 1000000000ull << "."
+        << std::setw(6) << std::setfill('0') << window_start % 1000000000ull / 1000ull << ") "
+        << std::setfill(' ') << bus_name << "\n";
+    for (std::size_t i = 0; i < n; i++)
+    {
+        const auto& a = aggregates[i];
+        std::cout << "  " << messages[a.signal->getGlobalIndex()]->getName() << "." << a.signal->getName()
+            << ": count: " << a.count << ", min: " << a.min << ", max: " << a.max
+            << ", mean: " << a.mean << ", variance: " << a.variance
+            << ", last: " << a.last << " " << a.signal->getUnit() << "\n";
+    }
+}
+// window in nanoseconds, 0 decodes the frames instead
+void create_statistics(Bus& b, uint64_t window)
+{
+    if (window && b.net)
+    {
+        // the message of each signal by global index
+        std::vector<const dbcppp::Message*> messages(b.net->signalCount());
+        b.net->forEachMessage(
+            [&](const dbcppp::Message& msg)
+            {
+                for (const dbcppp::Signal& sig : msg.signals())
+                {
+                    messages[sig.getGlobalIndex()] = &msg;
+                }
+            });
+        b.stats = dbcppp::SignalStatistics::create(*b.net, window,
+            [name = b.name, messages = std::move(messages)](uint64_t window_start, const dbcppp::SignalStatistics::Aggregate* aggregates, std::size_t n)
+            {
+                print_statistics(name, messages, window_start, aggregates, n);
+            });
+    }
+}
+void print_frame(const dbcppp::Frame& frame, const std::string& bus_name)
+{
+    if (frame.timestamp)
+    {
+        std::cout << "(" << frame.timestamp / 1000000000ull << "."
+            << std::setw(6) << std::setfill('0') << frame.timestamp % 1000000000ull / 1000ull << ") "
+            << std::setfill(' ');
+    }
+    std::cout << bus_name << "  "
+        << std::hex << std::uppercase << std::setw((frame.id & 0x80000000) ? 8 : 3) << std::setfill('0')
+        << (frame.id & 0x1FFFFFFF) << std::setfill(' ') << std::dec
+        << "   [" << unsigned(frame.size) << "] ";
+    for (std::size_t k = 0; k < frame.size; k++)
+    {
+        std::cout << " " << std::hex << std::uppercase << std::setw(2) << std::setfill('0')
+            << unsigned(frame.data[k]) << std::setfill(' ') << std::dec;
+    }
+    std::cout << " :: ";
+}
+#ifdef __linux__
+int decode_socketcan(const std::vector<std::string>& opt_sockets, uint64_t window)
+{
+    std::vector<Bus> buses;
+    std::vector<std::unique_ptr<dbcppp::SocketCAN>> sockets;
+    std::vector<pollfd> fds;
+    for (const auto& opt_socket : opt_sockets)
+    {
+        Bus b = parse_bus(opt_socket);
+        if (!b.net)
+        {
+            return 1;
+        }
+        create_statistics(b, window);
+        auto socket = dbcppp::SocketCAN::create(b.name, uint32_t(buses.size()));
+        if (!socket)
+        {
+            return 1;
+        }
+        fds.push_back(pollfd{socket->getFileDescriptor(), POLLIN, 0});
+        sockets.push_back(std::move(socket));
+        buses.push_back(std::move(b));
+    }
+    std::vector<dbcppp::Frame> frames(64);
+    while (poll(&fds[0], fds.size(), -1) >= 0)
+    {
+        for (std::size_t i = 0; i < fds.size(); i++)
+        {
+            if (!(fds[i].revents & POLLIN))
+            {
+                continue;
+            }
+            std::size_t n = sockets[i]->receive(&frames[0], frames.size());
+            for (std::size_t j = 0; j < n; j++)
+            {
+                const auto& frame = frames[j];
+                const dbcppp::Message* msg = buses[frame.bus].net->getMessageById(frame.id);
+                if (msg && buses[frame.bus].stats)
+                {
+                    buses[frame.bus].stats->add(*msg, frame.data, frame.timestamp);
+                }
+                else if (msg)
+                {
+                    print_frame(frame, buses[frame.bus].name);
+                    print_signals(*msg, frame.data);
+                }
+            }
+        }
+    }
+    return 0;
 }
+#endif
 
 int main(int argc, char** args)
 {
@@ -36,13 +206,25 @@ int main(int argc, char** args)
     po::options_description desc_dbc2("Options");
     desc_dbc2.add_options()
         ("help", "produce help message")
-        ("format,f", po::value<std::string>()->required(), "output format (C, DBC, human)")
+        ("format,f", po::value<std::string>()->required(), "output format (C, C++, DBC, human)")
         ("dbc", po::value<std::vector<std::string>>()->multitoken()->required(), "list of DBC files");
     
     po::options_description desc_decode("Options");
     desc_decode.add_options()
         ("help", "produce help message")
-        ("bus", po::value<std::vector<std::string>>()->required(), "list of buses in format (<bus name, DBC filename>)");
+        ("bus", po::value<std::vector<std::string>>(), "list of buses in format (<bus name, DBC filename>)")
+        ("socketcan", po::value<std::vector<std::string>>(), "list of CAN interfaces to read directly in format (<interface name, DBC filename>)")
+        ("input", po::value<std::string>()->default_value("-"), "candump log file to decode, - for stdin")
+        ("io", po::value<std::string>()->default_value("io_uring"), "input backend for --input (read, io_uring)")
+        ("stats", po::value<double>()->implicit_value(1.), "print per signal statistics over windows of the given seconds instead of the decoded frames");
+
+    po::options_description desc_bench("Options");
+    desc_bench.add_options()
+        ("help", "produce help message")
+        ("dbc", po::value<std::string>(), "DBC file to benchmark, a random DBC is generated if omitted")
+        ("messages", po::value<std::size_t>()->default_value(1000), "number of messages of the generated DBC")
+        ("frames", po::value<std::size_t>()->default_value(100000), "number of random frames")
+        ("seed", po::value<uint32_t>()->default_value(0), "seed for the random DBC and frames");
 
     if (std::string("dbc2") == args[1])
     {
@@ -74,7 +256,7 @@ int main(int argc, char** args)
             auto nets = dbcppp::Network::fromFile(dbc);
             for (auto& other : nets)
             {
-                net->merge(std::move(other.second));
+                net->merge(std::move(other.second), other.first);
             }
         }
         if (format == "C")
@@ -82,6 +264,11 @@ int main(int argc, char** args)
             using namespace dbcppp::Network2C;
             std::cout << *net;
         }
+        else if (format == "C++")
+        {
+            using namespace dbcppp::Network2Cpp;
+            std::cout << *net;
+        }
         else if (format == "DBC")
         {
             using namespace dbcppp::Network2DBC;
@@ -102,7 +289,7 @@ int main(int argc, char** args)
         po::store(po::command_line_parser(argc, args).options(desc).positional(p).run(), vm);
         if (vm.count("help"))
         {
-            std::cout << "Usage:\ndbcppp decode [--help] --dbc=<bus name,DBC filename>...\n";
+            std::cout << "Usage:\ndbcppp decode [--help] [--input=<log filename>] [--io=<backend>] [--stats[=<seconds>]] --bus=<bus name,DBC filename>... | --socketcan=<interface name,DBC filename>...\n";
             std::cout << desc_decode;
             return 1;
         }
@@ -115,102 +302,114 @@ int main(int argc, char** args)
             std::cout << e.what() << std::endl;
             return 1;
         }
-        const auto& opt_buses = vm["bus"].as<std::vector<std::string>>();
-        struct Bus
+        uint64_t window = 0;
+        if (vm.count("stats"))
         {
-            std::string name;
-            std::unique_ptr<dbcppp::Network> net;
-        };
+            double seconds = vm["stats"].as<double>();
+            if (!(seconds > 0.))
+            {
+                std::cout << "Error! The statistics window must be positive" << std::endl;
+                return 1;
+            }
+            window = uint64_t(seconds * 1e9);
+        }
+        if (vm.count("socketcan"))
+        {
+#ifdef __linux__
+            return decode_socketcan(vm["socketcan"].as<std::vector<std::string>>(), window);
+#else
+            std::cout << "Error! --socketcan is only supported on Linux" << std::endl;
+            return 1;
+#endif
+        }
+        if (!vm.count("bus"))
+        {
+            std::cout << "the option '--bus' or '--socketcan' is required but missing" << std::endl;
+            return 1;
+        }
+        const auto& opt_buses = vm["bus"].as<std::vector<std::string>>();
         tsl::robin_map<std::string, Bus> buses;
         for (const auto& opt_bus : opt_buses)
         {
-            std::istringstream ss(opt_bus);
-            std::string opt;
-            Bus b;
-            if (std::getline(ss, opt, ','))
-            {
-                b.name = opt;
-            }
-            else
-            {
-                // TODO error
-            }
-            if (std::getline(ss, opt))
-            {
-                std::ifstream fdbc(opt);
-                b.net = dbcppp::Network::fromDBC(fdbc);
-            }
-            else
-            {
-                // TODO error
-            }
+            Bus b = parse_bus(opt_bus);
+            create_statistics(b, window);
             buses.insert(std::make_pair(b.name, std::move(b)));
         }
-        // example line: vcan0  123   [3]  11 22 33
-        std::regex regex_candump_line(
-            // vcan0
-            "^\\s*(\\S+)"
-            // 123
-            "\\s*([0-9A-F]{3})"
-            // 3
-            "\\s*\\[(\\d+)\\]"
-            // 11
-            "\\s*([0-9A-F]{2})?"
-            // 22
-            "\\s*([0-9A-F]{2})?"
-            // 33
-            "\\s*([0-9A-F]{2})?"
-            // ...
-            "\\s*([0-9A-F]{2})?"
-            "\\s*([0-9A-F]{2})?"
-            "\\s*([0-9A-F]{2})?"
-            "\\s*([0-9A-F]{2})?"
-            "\\s*([0-9A-F]{2})?");
-        std::string line;
-        while (std::getline(std::cin, line))
-        {
-            std::cmatch cm;
-            std::regex_match(line.c_str(), cm, regex_candump_line);
-            const auto& bus = buses.find(cm[1].str());
-            if (bus != buses.end())
+        auto backend = dbcppp::FrameSource::Backend::IoUring;
+        const auto& opt_io = vm["io"].as<std::string>();
+        if (opt_io == "read")
+        {
+            backend = dbcppp::FrameSource::Backend::Read;
+        }
+        else if (opt_io != "io_uring")
+        {
+            std::cout << "Error! Unknown input backend \"" << opt_io << "\"" << std::endl;
+            return 1;
+        }
+        const auto& opt_input = vm["input"].as<std::string>();
+        auto source = dbcppp::FrameSource::create(opt_input, backend);
+        if (!source)
+        {
+            std::cout << "Error! Couldn't open \"" << opt_input << "\"" << std::endl;
+            return 1;
+        }
+        // the source numbers the buses in order of appearance, map them to the networks once
+        std::vector<const Bus*> source_buses;
+        std::vector<dbcppp::Frame> frames(1024);
+        while (std::size_t n = source->read(&frames[0], frames.size()))
+        {
+            for (std::size_t i = 0; i < n; i++)
             {
-                uint64_t msg_id = std::strtol(cm[2].str().c_str(), nullptr, 16);
-                uint64_t msg_size = std::atoi(cm[3].str().c_str());
-                std::array<uint8_t, 8> data;
-                for (std::size_t i = 0; i < msg_size; i++)
+                const auto& frame = frames[i];
+                while (source_buses.size() <= frame.bus)
                 {
-                    data[i] = uint8_t(std::strtol(cm[4 + i].str().c_str(), nullptr, 16));
+                    auto iter = buses.find(source->getBusName(uint32_t(source_buses.size())));
+                    source_buses.push_back(iter != buses.end() ? &iter->second : nullptr);
                 }
-                const dbcppp::Message* msg = bus->second.net->getMessageById(msg_id);
-                if (msg)
+                const Bus* bus = source_buses[frame.bus];
+                if (bus)
                 {
-                    std::cout << line << " :: " << msg->getName() << "(";
-                    bool first = true;
-                    const auto* mux_sig = msg->getMuxSignal();
-                    msg->forEachSignal(
-                        [&](const dbcppp::Signal& sig)
-                        {
-                            if (sig.getMultiplexerIndicator() != dbcppp::Signal::Multiplexer::MuxValue ||
-                                mux_sig && sig.getMultiplexerSwitchValue() == mux_sig->decode(&data[0]))
-                            {
-                                if (first) first = false; else std::cout << ", ";
-                                auto raw = sig.decode(&data[0]);
-                                auto desc = sig.getValueDescriptionByValue(raw);
-                                if (desc != nullptr)
-                                {
-                                    std::cout << sig.getName() << ": " << desc << " " << sig.getUnit();
-                                }
-                                else
-                                {
-                                    auto val = sig.rawToPhys(raw);
-                                    std::cout << sig.getName() << ": " << val << " " << sig.getUnit();
-                                }
-                            }
-                        });
-                    std::cout << ")\n";
+                    const dbcppp::Message* msg = bus->net->getMessageById(frame.id);
+                    if (msg && bus->stats)
+                    {
+                        bus->stats->add(*msg, frame.data, frame.timestamp);
+                    }
+                    else if (msg)
+                    {
+                        print_frame(frame, bus->name);
+                        print_signals(*msg, frame.data);
+                    }
                 }
             }
         }
+        for (auto& bus : buses)
+        {
+            if (bus.second.stats)
+            {
+                bus.second.stats->flush();
+            }
+        }
+    }
+    else if (std::string("bench") == args[1])
+    {
+        po::options_description desc("Allowed options");
+        desc.add(desc_subprogram).add(desc_bench);
+
+        po::variables_map vm;
+        po::store(po::command_line_parser(argc, args).options(desc).positional(p).run(), vm);
+        if (vm.count("help"))
+        {
+            std::cout << "Usage:\ndbcppp bench [--help] [--dbc=<DBC filename>] [--messages=<n>] [--frames=<n>] [--seed=<n>]\n";
+            std::cout << desc_bench;
+            return 1;
+        }
+        po::notify(vm);
+        return run_bench(
+              vm.count("dbc") ? vm["dbc"].as<std::string>() : std::string()
+            , vm["messages"].as<std::size_t>()
+            , vm["frames"].as<std::size_t>()
+            , vm["seed"].as<uint32_t>()
+            , std::cout);
     }
     else
     {
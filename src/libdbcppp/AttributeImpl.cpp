@@ -17,7 +17,7 @@ std::unique_ptr<Attribute> Attribute::create(
 }
 
 AttributeImpl::AttributeImpl(std::string&& name, AttributeDefinition::ObjectType object_type, Attribute::value_t value)
-    : _name(std::move(name))
+    : _name(StringPool::intern(name))
     , _object_type(std::move(object_type))
     , _value(std::move(value))
 {}
@@ -27,7 +27,7 @@ std::unique_ptr<Attribute> AttributeImpl::clone() const
 }
 const std::string& AttributeImpl::getName() const
 {
-    return _name;
+    return *_name;
 }
 AttributeDefinition::ObjectType AttributeImpl::getObjectType() const
 {
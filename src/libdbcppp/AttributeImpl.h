@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include "../../include/dbcppp/Attribute.h"
+#include "StringPool.h"
 
 namespace dbcppp
 {
@@ -19,7 +20,7 @@ namespace dbcppp
         virtual const value_t& getValue() const override;
 
     private:
-        std::string _name;
+        const std::string* _name;
         AttributeDefinition::ObjectType _object_type;
         Attribute::value_t _value;
     };
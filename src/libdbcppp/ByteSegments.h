@@ -0,0 +1,63 @@
+
+#pragma once
+
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include "../../include/dbcppp/Signal.h"
+
+namespace dbcppp
+{
+    // the bits a signal occupies in one byte of the message:
+    // bits [lo, lo + n) of the byte are the bits [raw_pos, raw_pos + n) of the raw value
+    struct ByteSegment
+    {
+        uint64_t byte;
+        uint64_t lo;
+        uint64_t n;
+        uint64_t raw_pos;
+    };
+    inline std::vector<ByteSegment> byte_segments(const Signal& sig)
+    {
+        std::map<uint64_t, ByteSegment> segments;
+        auto add = [&](uint64_t src, uint64_t dst)
+        {
+            auto iter = segments.find(src / 8);
+            if (iter == segments.end())
+            {
+                segments.insert(std::make_pair(src / 8, ByteSegment{src / 8, src % 8, 1, dst}));
+            }
+            else
+            {
+                // within one byte the raw bits and the message bits ascend together, for both byte orders
+                iter->second.lo = std::min(iter->second.lo, src % 8);
+                iter->second.raw_pos = std::min(iter->second.raw_pos, dst);
+                iter->second.n++;
+            }
+        };
+        uint64_t src = sig.getStartBit();
+        if (sig.getByteOrder() == Signal::ByteOrder::BigEndian)
+        {
+            uint64_t dst = sig.getBitSize() - 1;
+            for (uint64_t i = 0; i < sig.getBitSize(); i++, dst--)
+            {
+                add(src, dst);
+                src = src % 8 == 0 ? src + 15 : src - 1;
+            }
+        }
+        else
+        {
+            for (uint64_t dst = 0; dst < sig.getBitSize(); dst++, src++)
+            {
+                add(src, dst);
+            }
+        }
+        std::vector<ByteSegment> result;
+        for (const auto& s : segments)
+        {
+            result.push_back(s.second);
+        }
+        return result;
+    }
+}
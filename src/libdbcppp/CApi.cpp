@@ -583,6 +583,17 @@ extern "C"
                 cb(reinterpret_cast<const dbcppp_Signal*>(&sig), data);
             });
     }
+    DBCPPP_API const dbcppp_Signal* dbcppp_MessageGetSignalByIndex(const dbcppp_Message* msg, uint64_t index)
+    {
+        auto msgi = reinterpret_cast<const MessageImpl*>(msg);
+        auto result = msgi->getSignalByIndex(index);
+        return reinterpret_cast<const dbcppp_Signal*>(result);
+    }
+    DBCPPP_API uint64_t dbcppp_MessageSignalCount(const dbcppp_Message* msg)
+    {
+        auto msgi = reinterpret_cast<const MessageImpl*>(msg);
+        return msgi->signalCount();
+    }
     DBCPPP_API const dbcppp_Attribute* dbcppp_MessageGetAttributeValueByName(const dbcppp_Message* msg, const char* name)
     {
         auto msgi = reinterpret_cast<const MessageImpl*>(msg);
@@ -789,6 +800,17 @@ extern "C"
                 cb(reinterpret_cast<const dbcppp_Message*>(&m));
             });
     }
+    DBCPPP_API const dbcppp_Signal* dbcppp_NetworkGetSignalByGlobalIndex(const dbcppp_Network* net, uint64_t index)
+    {
+        auto neti = reinterpret_cast<const NetworkImpl*>(net);
+        const Signal* sig = neti->getSignalByGlobalIndex(index);
+        return reinterpret_cast<const dbcppp_Signal*>(sig);
+    }
+    DBCPPP_API uint64_t dbcppp_NetworkSignalCount(const dbcppp_Network* net)
+    {
+        auto neti = reinterpret_cast<const NetworkImpl*>(net);
+        return neti->signalCount();
+    }
     DBCPPP_API const dbcppp_EnvironmentVariable* dbcppp_NetworkGetEnvironmentVariableByName(const dbcppp_Network* net, const char* name)
     {
         auto neti = reinterpret_cast<const NetworkImpl*>(net);
@@ -1139,6 +1161,22 @@ extern "C"
                 cb(value, desc.c_str(), data);
             });
     }
+    DBCPPP_API void dbcppp_SignalGetValueDescriptionIds(const dbcppp_Signal* sig, const uint64_t* raws, uint64_t n, uint32_t* ids)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        sigi->getValueDescriptionIds(raws, n, ids);
+    }
+    DBCPPP_API const char* dbcppp_SignalGetValueDescriptionById(const dbcppp_Signal* sig, uint32_t id)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        const char* result = nullptr;
+        auto vd = sigi->getValueDescriptionById(id);
+        if (vd != nullptr)
+        {
+            result = vd->c_str();
+        }
+        return result;
+    }
     DBCPPP_API const dbcppp_Attribute* dbcppp_SignalGetAttributeValueByName(const dbcppp_Signal* sig, const char* name)
     {
         auto sigi = reinterpret_cast<const SignalImpl*>(sig);
@@ -1194,11 +1232,36 @@ extern "C"
         auto sigi = reinterpret_cast<const SignalImpl*>(sig);
         return sigi->rawToPhys(raw);
     }
+    DBCPPP_API float dbcppp_SignalRawToPhysFloat(const dbcppp_Signal* sig, uint64_t raw)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        return sigi->rawToPhysFloat(raw);
+    }
     DBCPPP_API uint64_t dbcppp_SignalPhysToRaw(const dbcppp_Signal* sig, double phys)
     {
         auto sigi = reinterpret_cast<const SignalImpl*>(sig);
         return sigi->physToRaw(phys);
     }
+    DBCPPP_API uint64_t dbcppp_SignalGetIndex(const dbcppp_Signal* sig)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        return sigi->getIndex();
+    }
+    DBCPPP_API uint64_t dbcppp_SignalGetGlobalIndex(const dbcppp_Signal* sig)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        return sigi->getGlobalIndex();
+    }
+    DBCPPP_API int32_t dbcppp_SignalGetDecimalScale(const dbcppp_Signal* sig)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        return sigi->getDecimalScale();
+    }
+    DBCPPP_API bool dbcppp_SignalRawToDecimal(const dbcppp_Signal* sig, uint64_t raw, int32_t scale, int64_t* mantissa)
+    {
+        auto sigi = reinterpret_cast<const SignalImpl*>(sig);
+        return sigi->rawToDecimal(raw, scale, *mantissa);
+    }
 
     DBCPPP_API const dbcppp_SignalType* dbcppp_SignalTypeCreate(
           const char* name
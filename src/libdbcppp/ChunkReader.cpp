@@ -0,0 +1,44 @@
+
+#include <cerrno>
+#include "ChunkReader.h"
+
+#ifdef _WIN32
+#include <io.h>
+#define read _read
+#define close _close
+#else
+#include <unistd.h>
+#endif
+
+using namespace dbcppp;
+
+ReadChunkReader::ReadChunkReader(int fd, bool owns_fd, std::size_t chunk_size)
+    : _fd(fd)
+    , _owns_fd(owns_fd)
+    , _buffer(chunk_size)
+{}
+ReadChunkReader::~ReadChunkReader()
+{
+    if (_owns_fd)
+    {
+        close(_fd);
+    }
+}
+bool ReadChunkReader::next(const char*& data, std::size_t& size)
+{
+    while (true)
+    {
+        auto n = read(_fd, &_buffer[0], unsigned(_buffer.size()));
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        data = &_buffer[0];
+        size = std::size_t(n);
+        return true;
+    }
+}
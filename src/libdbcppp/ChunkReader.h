@@ -0,0 +1,144 @@
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+
+namespace dbcppp
+{
+    // reads a file chunk wise, the returned chunk stays valid until the next call of next()
+    class ChunkReader
+    {
+    public:
+        virtual ~ChunkReader() = default;
+        // returns false at end of file or on error
+        virtual bool next(const char*& data, std::size_t& size) = 0;
+    };
+    class ReadChunkReader final
+        : public ChunkReader
+    {
+    public:
+        ReadChunkReader(int fd, bool owns_fd, std::size_t chunk_size);
+        ReadChunkReader(const ReadChunkReader&) = delete;
+        ReadChunkReader& operator=(const ReadChunkReader&) = delete;
+        virtual ~ReadChunkReader();
+
+        virtual bool next(const char*& data, std::size_t& size) override;
+
+    private:
+        int _fd;
+        bool _owns_fd;
+        std::vector<char> _buffer;
+    };
+#ifdef __linux__
+    // keeps queue_depth reads of chunk_size bytes in flight using io_uring with registered buffers
+    class IoUringChunkReader final
+        : public ChunkReader
+    {
+    public:
+        // returns nullptr if io_uring isn't available (e.g. old kernel or seccomp)
+        static std::unique_ptr<IoUringChunkReader> create(int fd, bool owns_fd, std::size_t chunk_size, unsigned queue_depth);
+
+        IoUringChunkReader(const IoUringChunkReader&) = delete;
+        IoUringChunkReader& operator=(const IoUringChunkReader&) = delete;
+        virtual ~IoUringChunkReader();
+
+        virtual bool next(const char*& data, std::size_t& size) override;
+
+    private:
+        IoUringChunkReader() = default;
+        void submit(uint64_t chunk);
+        bool waitFor(uint64_t chunk);
+
+        int _fd{-1};
+        bool _owns_fd{false};
+        int _ring_fd{-1};
+        uint64_t _file_size{0};
+        std::size_t _chunk_size{0};
+        unsigned _queue_depth{0};
+
+        void* _sq_ring{nullptr};
+        std::size_t _sq_ring_size{0};
+        void* _cq_ring{nullptr};
+        std::size_t _cq_ring_size{0};
+        void* _sqes{nullptr};
+        std::size_t _sqes_size{0};
+        unsigned* _sq_tail{nullptr};
+        unsigned* _sq_mask{nullptr};
+        unsigned* _sq_array{nullptr};
+        unsigned* _cq_head{nullptr};
+        unsigned* _cq_tail{nullptr};
+        unsigned* _cq_mask{nullptr};
+        void* _cqes{nullptr};
+
+        std::unique_ptr<char[]> _buffers;
+        // result of the read which is currently stored in the buffer, in_flight if it isn't completed yet
+        static constexpr int64_t in_flight = INT64_MIN;
+        std::vector<int64_t> _results;
+        unsigned _to_submit{0};
+        uint64_t _n_chunks{0};
+        uint64_t _next_chunk{0};
+        uint64_t _next_submit{0};
+    };
+#endif
+    // decompresses the chunks of another reader on its own thread, so decompression overlaps with parsing
+    class DecompressingChunkReader final
+        : public ChunkReader
+    {
+    public:
+        enum class Codec
+        {
+            Gzip, Zstd
+        };
+        // detects the codec by the magic number, returns false if the data isn't compressed
+        // or support for the codec wasn't compiled in
+        static bool detect(const char* data, std::size_t size, Codec& codec);
+
+        // first is the chunk which was already read from reader to detect the codec
+        DecompressingChunkReader(
+              std::unique_ptr<ChunkReader> reader
+            , Codec codec
+            , const char* first
+            , std::size_t first_size
+            , std::size_t chunk_size
+            , unsigned n_buffers);
+        DecompressingChunkReader(const DecompressingChunkReader&) = delete;
+        DecompressingChunkReader& operator=(const DecompressingChunkReader&) = delete;
+        virtual ~DecompressingChunkReader();
+
+        virtual bool next(const char*& data, std::size_t& size) override;
+
+        class Decoder
+        {
+        public:
+            virtual ~Decoder() = default;
+            // decompresses from in into out[out_pos, out_size), advances in and out_pos, returns false on error
+            virtual bool decode(const char*& in, std::size_t& in_size, char* out, std::size_t& out_pos, std::size_t out_size) = 0;
+        };
+
+    private:
+        void run(const char* first, std::size_t first_size);
+
+        std::unique_ptr<ChunkReader> _reader;
+        std::unique_ptr<Decoder> _decoder;
+        std::size_t _chunk_size;
+        std::vector<std::vector<char>> _buffers;
+
+        std::mutex _mutex;
+        std::condition_variable _cv;
+        // buffers which were filled by the decompression thread and their sizes
+        std::deque<std::pair<unsigned, std::size_t>> _filled;
+        std::vector<unsigned> _free;
+        // buffer which is currently handed out by next()
+        int _current;
+        bool _done;
+        bool _stop;
+        std::thread _thread;
+    };
+}
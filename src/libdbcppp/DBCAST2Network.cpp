@@ -2,7 +2,7 @@
 #include <boost/log/trivial.hpp>
 #include <iterator>
 #include "../../include/dbcppp/Network.h"
-#include "DBC_Grammar.h"
+#include "DBCAST2Network.h"
 
 using namespace dbcppp;
 
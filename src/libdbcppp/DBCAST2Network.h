@@ -0,0 +1,11 @@
+
+#pragma once
+
+#include <memory>
+#include "../../include/dbcppp/Export.h"
+#include "../../include/dbcppp/Network.h"
+#include "DBC_Grammar.h"
+
+// converts the AST produced by the DBC grammar into a Network,
+// exported so the benchmarks can time parsing and conversion separately
+DBCPPP_API std::unique_ptr<dbcppp::Network> DBCAST2Network(const dbcppp::G_Network& gnet);
@@ -0,0 +1,215 @@
+
+#include <cstring>
+#include "ChunkReader.h"
+
+#ifdef DBCPPP_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef DBCPPP_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+using namespace dbcppp;
+
+#ifdef DBCPPP_HAVE_ZLIB
+class GzipDecoder final
+    : public DecompressingChunkReader::Decoder
+{
+public:
+    GzipDecoder()
+    {
+        std::memset(&_stream, 0, sizeof(_stream));
+        // 15 + 32: maximum window size and automatic zlib/gzip header detection
+        inflateInit2(&_stream, 15 + 32);
+    }
+    virtual ~GzipDecoder()
+    {
+        inflateEnd(&_stream);
+    }
+    virtual bool decode(const char*& in, std::size_t& in_size, char* out, std::size_t& out_pos, std::size_t out_size) override
+    {
+        _stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in));
+        _stream.avail_in = uInt(in_size);
+        _stream.next_out = reinterpret_cast<Bytef*>(out + out_pos);
+        _stream.avail_out = uInt(out_size - out_pos);
+        int ret = inflate(&_stream, Z_NO_FLUSH);
+        in = reinterpret_cast<const char*>(_stream.next_in);
+        in_size = _stream.avail_in;
+        out_pos = out_size - _stream.avail_out;
+        if (ret == Z_STREAM_END)
+        {
+            // gzip files may consist of several concatenated members
+            return inflateReset(&_stream) == Z_OK;
+        }
+        return ret == Z_OK || ret == Z_BUF_ERROR;
+    }
+
+private:
+    z_stream _stream;
+};
+#endif
+#ifdef DBCPPP_HAVE_ZSTD
+class ZstdDecoder final
+    : public DecompressingChunkReader::Decoder
+{
+public:
+    ZstdDecoder()
+        : _stream(ZSTD_createDStream())
+    {
+        ZSTD_initDStream(_stream);
+    }
+    virtual ~ZstdDecoder()
+    {
+        ZSTD_freeDStream(_stream);
+    }
+    virtual bool decode(const char*& in, std::size_t& in_size, char* out, std::size_t& out_pos, std::size_t out_size) override
+    {
+        ZSTD_inBuffer input{in, in_size, 0};
+        ZSTD_outBuffer output{out, out_size, out_pos};
+        std::size_t ret = ZSTD_decompressStream(_stream, &output, &input);
+        in += input.pos;
+        in_size -= input.pos;
+        out_pos = output.pos;
+        return !ZSTD_isError(ret);
+    }
+
+private:
+    ZSTD_DStream* _stream;
+};
+#endif
+
+bool DecompressingChunkReader::detect(const char* data, std::size_t size, Codec& codec)
+{
+    const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+#ifdef DBCPPP_HAVE_ZLIB
+    if (size >= 2 && bytes[0] == 0x1F && bytes[1] == 0x8B)
+    {
+        codec = Codec::Gzip;
+        return true;
+    }
+#endif
+#ifdef DBCPPP_HAVE_ZSTD
+    if (size >= 4 && bytes[0] == 0x28 && bytes[1] == 0xB5 && bytes[2] == 0x2F && bytes[3] == 0xFD)
+    {
+        codec = Codec::Zstd;
+        return true;
+    }
+#endif
+    return false;
+}
+DecompressingChunkReader::DecompressingChunkReader(
+      std::unique_ptr<ChunkReader> reader
+    , Codec codec
+    , const char* first
+    , std::size_t first_size
+    , std::size_t chunk_size
+    , unsigned n_buffers)
+
+    : _reader(std::move(reader))
+    , _chunk_size(chunk_size)
+    , _buffers(n_buffers, std::vector<char>(chunk_size))
+    , _current(-1)
+    , _done(false)
+    , _stop(false)
+{
+    switch (codec)
+    {
+#ifdef DBCPPP_HAVE_ZLIB
+    case Codec::Gzip: _decoder = std::make_unique<GzipDecoder>(); break;
+#endif
+#ifdef DBCPPP_HAVE_ZSTD
+    case Codec::Zstd: _decoder = std::make_unique<ZstdDecoder>(); break;
+#endif
+    default: break;
+    }
+    for (unsigned i = 0; i < n_buffers; i++)
+    {
+        _free.push_back(i);
+    }
+    if (_decoder)
+    {
+        _thread = std::thread(&DecompressingChunkReader::run, this, first, first_size);
+    }
+    else
+    {
+        _done = true;
+    }
+}
+DecompressingChunkReader::~DecompressingChunkReader()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+void DecompressingChunkReader::run(const char* in, std::size_t in_size)
+{
+    bool finished = false;
+    while (!finished)
+    {
+        unsigned buffer;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [&] { return _stop || !_free.empty(); });
+            if (_stop)
+            {
+                return;
+            }
+            buffer = _free.back();
+            _free.pop_back();
+        }
+        char* out = &_buffers[buffer][0];
+        std::size_t out_pos = 0;
+        while (out_pos < _chunk_size)
+        {
+            if (in_size == 0 && !_reader->next(in, in_size))
+            {
+                finished = true;
+                break;
+            }
+            if (!_decoder->decode(in, in_size, out, out_pos, _chunk_size))
+            {
+                finished = true;
+                break;
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (out_pos)
+            {
+                _filled.emplace_back(buffer, out_pos);
+            }
+            else
+            {
+                _free.push_back(buffer);
+            }
+            _done = finished;
+        }
+        _cv.notify_all();
+    }
+}
+bool DecompressingChunkReader::next(const char*& data, std::size_t& size)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_current >= 0)
+    {
+        _free.push_back(unsigned(_current));
+        _current = -1;
+        _cv.notify_all();
+    }
+    _cv.wait(lock, [&] { return _done || !_filled.empty(); });
+    if (_filled.empty())
+    {
+        return false;
+    }
+    _current = int(_filled.front().first);
+    size = _filled.front().second;
+    _filled.pop_front();
+    data = &_buffers[_current][0];
+    return true;
+}
@@ -24,11 +24,6 @@ std::unique_ptr<EnvironmentVariable> EnvironmentVariable::create(
         avs.insert(std::make_pair(av.first, std::move(static_cast<AttributeImpl&>(*av.second))));
         av.second.reset(nullptr);
     }
-    tsl::robin_map<int64_t, std::string> ads;
-    for (auto&& ad : value_descriptions)
-    {
-        ads.insert(std::move(ad));
-    }
     return std::make_unique<EnvironmentVariableImpl>(
           std::move(name)
         , var_type
@@ -39,7 +34,7 @@ std::unique_ptr<EnvironmentVariable> EnvironmentVariable::create(
         , ev_id
         , access_type
         , std::move(access_nodes)
-        , std::move(ads)
+        , ValueDescriptions::intern(std::move(value_descriptions))
         , data_size
         , std::move(avs)
         , std::move(comment));
@@ -55,7 +50,7 @@ EnvironmentVariableImpl::EnvironmentVariableImpl(
     , uint64_t ev_id
     , AccessType access_type
     , std::set<std::string>&& access_nodes
-    , tsl::robin_map<int64_t, std::string>&& value_descriptions
+    , std::shared_ptr<const ValueDescriptions> value_descriptions
     , uint64_t data_size
     , std::map<std::string, AttributeImpl>&& attribute_values
     , std::string&& comment)
@@ -112,28 +107,22 @@ EnvironmentVariable::AccessType EnvironmentVariableImpl::getAccessType() const
 }
 bool EnvironmentVariableImpl::hasAccessNode(const std::string& name) const
 {
-    return _access_nodes.find(name) != _access_nodes.end();
+    return _access_nodes.contains(name);
 }
 void EnvironmentVariableImpl::forEachAccessNode(std::function<void(const std::string&)>&& cb) const
 {
-    for (const auto& n : _access_nodes)
+    for (const auto* n : _access_nodes)
     {
-        cb(n);
+        cb(*n);
     }
 }
 const std::string* EnvironmentVariableImpl::getValueDescriptionByValue(int64_t value) const
 {
-    const std::string* result = nullptr;
-    auto iter = _value_descriptions.find(value);
-    if (iter != _value_descriptions.end())
-    {
-        result = &iter->second;
-    }
-    return result;
+    return _value_descriptions->find(value);
 }
 void EnvironmentVariableImpl::forEachValueDescription(std::function<void(int64_t, const std::string&)>&& cb) const
 {
-    for (const auto& vd : _value_descriptions)
+    for (const auto& vd : _value_descriptions->descriptions())
     {
         cb(vd.first, vd.second);
     }
@@ -144,22 +133,16 @@ uint64_t EnvironmentVariableImpl::getDataSize() const
 }
 const Attribute* EnvironmentVariableImpl::getAttributeValueByName(const std::string& name) const
 {
-    const Attribute* result = nullptr;
-    auto iter = _attribute_values.find(name);
-    if (iter != _attribute_values.end())
-    {
-        result = &iter->second;
-    }
-    return result;
+    return _attribute_values.find(name);
 }
 const Attribute* EnvironmentVariableImpl::findAttributeValue(std::function<bool(const Attribute&)>&& pred) const
 {
     const Attribute* result = nullptr;
     for (const auto& av : _attribute_values)
     {
-        if (pred(av.second))
+        if (pred(av))
         {
-            result = &av.second;
+            result = &av;
             break;
         }
     }
@@ -169,7 +152,7 @@ void EnvironmentVariableImpl::forEachAttributeValue(std::function<void(const Att
 {
     for (const auto& av : _attribute_values)
     {
-        cb(av.second);
+        cb(av);
     }
 }
 const std::string& EnvironmentVariableImpl::getComment() const
@@ -2,6 +2,7 @@
 #pragma once
 
 #include <robin-map/tsl/robin_map.h>
+#include "ValueDescriptions.h"
 #include "../../include/dbcppp/EnvironmentVariable.h"
 #include "NodeImpl.h"
 #include "AttributeImpl.h"
@@ -22,7 +23,7 @@ namespace dbcppp
             , uint64_t ev_id
             , AccessType access_type
             , std::set<std::string>&& access_nodes
-            , tsl::robin_map<int64_t, std::string>&& value_descriptions
+            , std::shared_ptr<const ValueDescriptions> value_descriptions
             , uint64_t data_size
             , std::map<std::string, AttributeImpl>&& attribute_values
             , std::string&& comment);
@@ -56,10 +57,10 @@ namespace dbcppp
         double _initial_value;
         uint64_t _ev_id;
         AccessType _access_type;
-        std::set<std::string> _access_nodes;
-        tsl::robin_map<int64_t, std::string> _value_descriptions;
+        InternedStringSet _access_nodes;
+        std::shared_ptr<const ValueDescriptions> _value_descriptions;
         uint64_t _data_size;
-        std::map<std::string, AttributeImpl> _attribute_values;
+        SortedByName<AttributeImpl> _attribute_values;
         std::string _comment;
     };
 }
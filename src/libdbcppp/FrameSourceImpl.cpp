@@ -0,0 +1,308 @@
+
+#include <cstring>
+#include <fcntl.h>
+#include "FrameSourceImpl.h"
+
+#ifdef _WIN32
+#include <io.h>
+#define open _open
+#define O_RDONLY _O_RDONLY
+#endif
+
+using namespace dbcppp;
+
+static constexpr std::size_t chunk_size = 1 << 20;
+static constexpr unsigned queue_depth = 8;
+// number of decompressed chunks which may be buffered ahead of the parser
+static constexpr unsigned n_decompressed_chunks = 4;
+
+std::unique_ptr<FrameSource> FrameSource::create(const std::string& filename, Backend backend)
+{
+    bool is_stdin = filename == "-";
+    int fd = is_stdin ? 0 : open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+    std::unique_ptr<ChunkReader> reader;
+#ifdef __linux__
+    if (backend == Backend::IoUring)
+    {
+        reader = IoUringChunkReader::create(fd, !is_stdin, chunk_size, queue_depth);
+    }
+#endif
+    if (!reader)
+    {
+        backend = Backend::Read;
+        reader = std::make_unique<ReadChunkReader>(fd, !is_stdin, chunk_size);
+    }
+    const char* first = nullptr;
+    std::size_t first_size = 0;
+    if (!reader->next(first, first_size))
+    {
+        return std::make_unique<FrameSourceImpl>(std::move(reader), backend, Compression::None, nullptr, 0);
+    }
+    DecompressingChunkReader::Codec codec;
+    if (DecompressingChunkReader::detect(first, first_size, codec))
+    {
+        reader = std::make_unique<DecompressingChunkReader>(
+            std::move(reader), codec, first, first_size, chunk_size, n_decompressed_chunks);
+        auto compression = codec == DecompressingChunkReader::Codec::Gzip ? Compression::Gzip : Compression::Zstd;
+        return std::make_unique<FrameSourceImpl>(std::move(reader), backend, compression, nullptr, 0);
+    }
+    return std::make_unique<FrameSourceImpl>(std::move(reader), backend, Compression::None, first, first_size);
+}
+
+FrameSourceImpl::FrameSourceImpl(
+      std::unique_ptr<ChunkReader> reader
+    , Backend backend
+    , Compression compression
+    , const char* first
+    , std::size_t first_size)
+
+    : _reader(std::move(reader))
+    , _backend(backend)
+    , _compression(compression)
+    , _pos(first)
+    , _end(first + first_size)
+    , _eof(false)
+    , _last_bus(0)
+{}
+FrameSource::Backend FrameSourceImpl::getBackend() const
+{
+    return _backend;
+}
+FrameSource::Compression FrameSourceImpl::getCompression() const
+{
+    return _compression;
+}
+std::size_t FrameSourceImpl::read(Frame* frames, std::size_t n)
+{
+    std::size_t result = 0;
+    while (result < n)
+    {
+        if (_pos == _end)
+        {
+            std::size_t size;
+            if (_eof || !_reader->next(_pos, size))
+            {
+                _eof = true;
+                _pos = _end = nullptr;
+                // last line without newline
+                if (!_carry.empty())
+                {
+                    if (parseLine(_carry.data(), _carry.data() + _carry.size(), frames[result]))
+                    {
+                        result++;
+                    }
+                    _carry.clear();
+                }
+                break;
+            }
+            _end = _pos + size;
+        }
+        const char* nl = reinterpret_cast<const char*>(std::memchr(_pos, '\n', _end - _pos));
+        if (!nl)
+        {
+            _carry.append(_pos, _end);
+            _pos = _end;
+            continue;
+        }
+        bool ok;
+        if (_carry.empty())
+        {
+            ok = parseLine(_pos, nl, frames[result]);
+        }
+        else
+        {
+            _carry.append(_pos, nl);
+            ok = parseLine(_carry.data(), _carry.data() + _carry.size(), frames[result]);
+            _carry.clear();
+        }
+        _pos = nl + 1;
+        if (ok)
+        {
+            result++;
+        }
+    }
+    return result;
+}
+const std::string& FrameSourceImpl::getBusName(uint32_t bus) const
+{
+    return _bus_names[bus];
+}
+uint32_t FrameSourceImpl::busId(const char* begin, const char* end)
+{
+    std::size_t len = std::size_t(end - begin);
+    if (!_bus_names.empty())
+    {
+        const auto& last = _bus_names[_last_bus];
+        if (last.size() == len && std::memcmp(last.data(), begin, len) == 0)
+        {
+            return _last_bus;
+        }
+    }
+    std::string name(begin, end);
+    auto iter = _bus_ids.find(name);
+    if (iter == _bus_ids.end())
+    {
+        uint32_t id = uint32_t(_bus_names.size());
+        _bus_names.push_back(name);
+        iter = _bus_ids.insert(std::make_pair(std::move(name), id)).first;
+    }
+    _last_bus = iter->second;
+    return _last_bus;
+}
+
+static inline int hex_value(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+static inline const char* skip_spaces(const char* p, const char* end)
+{
+    while (p != end && (*p == ' ' || *p == '\t' || *p == '\r'))
+    {
+        p++;
+    }
+    return p;
+}
+bool FrameSourceImpl::parseLine(const char* p, const char* end, Frame& frame)
+{
+    frame.timestamp = 0;
+    frame.flags = 0;
+    frame.reserved0 = 0;
+    frame.reserved1 = 0;
+    p = skip_spaces(p, end);
+    // optional "(<seconds>.<fraction>)"
+    if (p != end && *p == '(')
+    {
+        p++;
+        uint64_t sec = 0;
+        while (p != end && *p >= '0' && *p <= '9')
+        {
+            sec = sec * 10 + uint64_t(*p++ - '0');
+        }
+        uint64_t nsec = 0;
+        uint64_t scale = 100000000;
+        if (p != end && *p == '.')
+        {
+            p++;
+            while (p != end && *p >= '0' && *p <= '9')
+            {
+                nsec += uint64_t(*p++ - '0') * scale;
+                scale /= 10;
+            }
+        }
+        if (p == end || *p != ')')
+        {
+            return false;
+        }
+        p++;
+        frame.timestamp = sec * 1000000000ull + nsec;
+        p = skip_spaces(p, end);
+    }
+    const char* bus_begin = p;
+    while (p != end && *p != ' ' && *p != '\t')
+    {
+        p++;
+    }
+    if (p == bus_begin)
+    {
+        return false;
+    }
+    frame.bus = busId(bus_begin, p);
+    p = skip_spaces(p, end);
+    uint32_t id = 0;
+    const char* id_begin = p;
+    int v;
+    while (p != end && (v = hex_value(*p)) >= 0)
+    {
+        id = (id << 4) | uint32_t(v);
+        p++;
+    }
+    std::size_t id_digits = std::size_t(p - id_begin);
+    if (id_digits == 0 || id_digits > 8)
+    {
+        return false;
+    }
+    // candump prints standard ids with 3 and extended ids with 8 digits
+    frame.id = id_digits > 3 ? (id & 0x1FFFFFFF) | 0x80000000 : id;
+    std::size_t size = 0;
+    if (p != end && *p == '#')
+    {
+        // log format: <id>#<data>, <id>##<flags><data> or <id>#R
+        p++;
+        if (p != end && *p == 'R')
+        {
+            frame.size = 0;
+            return true;
+        }
+        if (p != end && *p == '#')
+        {
+            p++;
+            if (p == end || (v = hex_value(*p)) < 0)
+            {
+                return false;
+            }
+            // CANFD_FDF
+            frame.flags = uint8_t(v) | 0x04;
+            p++;
+        }
+        while (p != end && size < sizeof(frame.data))
+        {
+            if (*p == '.')
+            {
+                p++;
+                continue;
+            }
+            int hi, lo;
+            if (p + 1 >= end || (hi = hex_value(p[0])) < 0 || (lo = hex_value(p[1])) < 0)
+            {
+                break;
+            }
+            frame.data[size++] = uint8_t((hi << 4) | lo);
+            p += 2;
+        }
+    }
+    else
+    {
+        // default format: <id>  [<size>]  <data bytes separated by spaces>
+        p = skip_spaces(p, end);
+        if (p == end || *p != '[')
+        {
+            return false;
+        }
+        p++;
+        std::size_t expected = 0;
+        while (p != end && *p >= '0' && *p <= '9')
+        {
+            expected = expected * 10 + std::size_t(*p++ - '0');
+        }
+        if (p == end || *p != ']' || expected > sizeof(frame.data))
+        {
+            return false;
+        }
+        p++;
+        for (; size < expected; size++)
+        {
+            p = skip_spaces(p, end);
+            int hi, lo;
+            if (p + 1 >= end || (hi = hex_value(p[0])) < 0 || (lo = hex_value(p[1])) < 0)
+            {
+                // e.g. "remote request"
+                return false;
+            }
+            frame.data[size] = uint8_t((hi << 4) | lo);
+            p += 2;
+        }
+        if (expected > 8)
+        {
+            frame.flags = 0x04;
+        }
+    }
+    frame.size = uint8_t(size);
+    return true;
+}
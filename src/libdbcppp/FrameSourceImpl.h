@@ -0,0 +1,51 @@
+
+#pragma once
+
+#include <vector>
+#include <robin-map/tsl/robin_map.h>
+
+#include "../../include/dbcppp/FrameSource.h"
+#include "ChunkReader.h"
+
+namespace dbcppp
+{
+    class FrameSourceImpl final
+        : public FrameSource
+    {
+    public:
+        // first is a chunk which was already read from reader, it's parsed before the rest of the file
+        FrameSourceImpl(
+              std::unique_ptr<ChunkReader> reader
+            , Backend backend
+            , Compression compression
+            , const char* first
+            , std::size_t first_size);
+        FrameSourceImpl(const FrameSourceImpl&) = delete;
+        FrameSourceImpl& operator=(const FrameSourceImpl&) = delete;
+
+        virtual Backend getBackend() const override;
+        virtual Compression getCompression() const override;
+        virtual std::size_t read(Frame* frames, std::size_t n) override;
+        virtual const std::string& getBusName(uint32_t bus) const override;
+
+        // parses one line without the trailing newline, returns false if it's not a frame
+        bool parseLine(const char* begin, const char* end, Frame& frame);
+
+    private:
+        uint32_t busId(const char* begin, const char* end);
+
+        std::unique_ptr<ChunkReader> _reader;
+        Backend _backend;
+        Compression _compression;
+        const char* _pos;
+        const char* _end;
+        bool _eof;
+        // beginning of a line which was split over two chunks
+        std::string _carry;
+
+        tsl::robin_map<std::string, uint32_t> _bus_ids;
+        std::vector<std::string> _bus_names;
+        // logs usually contain long runs of the same bus, so the last lookup is cached
+        uint32_t _last_bus;
+    };
+}
@@ -0,0 +1,219 @@
+
+#include "ChunkReader.h"
+
+#ifdef __linux__
+#include <cstring>
+#include <algorithm>
+#include <cerrno>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+using namespace dbcppp;
+
+// liburing isn't required, the few system calls we need are issued directly
+static int io_uring_setup(unsigned entries, io_uring_params* p)
+{
+    return int(syscall(__NR_io_uring_setup, entries, p));
+}
+static int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags)
+{
+    return int(syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+static int io_uring_register(int fd, unsigned opcode, const void* arg, unsigned nr_args)
+{
+    return int(syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+std::unique_ptr<IoUringChunkReader> IoUringChunkReader::create(int fd, bool owns_fd, std::size_t chunk_size, unsigned queue_depth)
+{
+    std::unique_ptr<IoUringChunkReader> result;
+    struct stat st;
+    if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+    {
+        return result;
+    }
+    io_uring_params p;
+    std::memset(&p, 0, sizeof(p));
+    int ring_fd = io_uring_setup(queue_depth, &p);
+    if (ring_fd < 0)
+    {
+        return result;
+    }
+    result.reset(new IoUringChunkReader());
+    result->_ring_fd = ring_fd;
+    result->_file_size = uint64_t(st.st_size);
+    result->_chunk_size = chunk_size;
+    result->_queue_depth = queue_depth;
+    result->_sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    result->_cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        result->_sq_ring_size = std::max(result->_sq_ring_size, result->_cq_ring_size);
+        result->_cq_ring_size = 0;
+    }
+    result->_sq_ring = mmap(nullptr, result->_sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+    if (result->_sq_ring == MAP_FAILED)
+    {
+        result->_sq_ring = nullptr;
+        return nullptr;
+    }
+    if (result->_cq_ring_size)
+    {
+        result->_cq_ring = mmap(nullptr, result->_cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+        if (result->_cq_ring == MAP_FAILED)
+        {
+            result->_cq_ring = nullptr;
+            return nullptr;
+        }
+    }
+    char* sq = reinterpret_cast<char*>(result->_sq_ring);
+    char* cq = result->_cq_ring ? reinterpret_cast<char*>(result->_cq_ring) : sq;
+    result->_sqes_size = p.sq_entries * sizeof(io_uring_sqe);
+    result->_sqes = mmap(nullptr, result->_sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+    if (result->_sqes == MAP_FAILED)
+    {
+        result->_sqes = nullptr;
+        return nullptr;
+    }
+    result->_sq_tail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+    result->_sq_mask = reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+    result->_sq_array = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+    result->_cq_head = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+    result->_cq_tail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+    result->_cq_mask = reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+    result->_cqes = cq + p.cq_off.cqes;
+
+    // register the buffers once, so the kernel doesn't have to map them for every read
+    result->_buffers.reset(new char[chunk_size * queue_depth]);
+    std::vector<iovec> iovecs(queue_depth);
+    for (unsigned i = 0; i < queue_depth; i++)
+    {
+        iovecs[i].iov_base = &result->_buffers[i * chunk_size];
+        iovecs[i].iov_len = chunk_size;
+    }
+    if (io_uring_register(ring_fd, IORING_REGISTER_BUFFERS, &iovecs[0], queue_depth) < 0)
+    {
+        return nullptr;
+    }
+    result->_fd = fd;
+    result->_owns_fd = owns_fd;
+    result->_results.resize(queue_depth, in_flight);
+    result->_n_chunks = (result->_file_size + chunk_size - 1) / chunk_size;
+    while (result->_next_submit < result->_n_chunks && result->_next_submit < queue_depth)
+    {
+        result->submit(result->_next_submit++);
+    }
+    return result;
+}
+IoUringChunkReader::~IoUringChunkReader()
+{
+    if (_sqes)
+    {
+        munmap(_sqes, _sqes_size);
+    }
+    if (_cq_ring)
+    {
+        munmap(_cq_ring, _cq_ring_size);
+    }
+    if (_sq_ring)
+    {
+        munmap(_sq_ring, _sq_ring_size);
+    }
+    if (_ring_fd >= 0)
+    {
+        close(_ring_fd);
+    }
+    if (_owns_fd && _fd >= 0)
+    {
+        close(_fd);
+    }
+}
+void IoUringChunkReader::submit(uint64_t chunk)
+{
+    unsigned buffer = unsigned(chunk % _queue_depth);
+    unsigned tail = *_sq_tail;
+    unsigned index = tail & *_sq_mask;
+    io_uring_sqe& sqe = reinterpret_cast<io_uring_sqe*>(_sqes)[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_READ_FIXED;
+    sqe.fd = _fd;
+    sqe.off = chunk * _chunk_size;
+    sqe.addr = reinterpret_cast<uint64_t>(&_buffers[buffer * _chunk_size]);
+    sqe.len = unsigned(_chunk_size);
+    sqe.buf_index = uint16_t(buffer);
+    sqe.user_data = buffer;
+    _sq_array[index] = index;
+    _results[buffer] = in_flight;
+    __atomic_store_n(_sq_tail, tail + 1, __ATOMIC_RELEASE);
+    _to_submit++;
+}
+bool IoUringChunkReader::waitFor(uint64_t chunk)
+{
+    unsigned buffer = unsigned(chunk % _queue_depth);
+    while (_results[buffer] == in_flight)
+    {
+        int ret = io_uring_enter(_ring_fd, _to_submit, 1, IORING_ENTER_GETEVENTS);
+        if (ret < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        _to_submit -= unsigned(ret) < _to_submit ? unsigned(ret) : _to_submit;
+        unsigned head = *_cq_head;
+        // completions may arrive out of order, they are consumed in file order though
+        while (head != __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE))
+        {
+            const io_uring_cqe& cqe = reinterpret_cast<const io_uring_cqe*>(_cqes)[head & *_cq_mask];
+            _results[cqe.user_data] = cqe.res;
+            head++;
+        }
+        __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+    }
+    return _results[buffer] >= 0;
+}
+bool IoUringChunkReader::next(const char*& data, std::size_t& size)
+{
+    // the buffer of the previous chunk is handed back to the kernel now
+    if (_next_chunk > 0 && _next_submit < _n_chunks)
+    {
+        submit(_next_submit++);
+    }
+    if (_next_chunk >= _n_chunks || !waitFor(_next_chunk))
+    {
+        return false;
+    }
+    uint64_t chunk = _next_chunk++;
+    unsigned buffer = unsigned(chunk % _queue_depth);
+    char* begin = &_buffers[buffer * _chunk_size];
+    std::size_t n = std::size_t(_results[buffer]);
+    uint64_t expected = std::min<uint64_t>(_chunk_size, _file_size - chunk * _chunk_size);
+    // short reads are completed synchronously, otherwise there would be a gap before the next chunk
+    while (n < expected)
+    {
+        auto ret = pread(_fd, begin + n, expected - n, off_t(chunk * _chunk_size + n));
+        if (ret < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (ret <= 0)
+        {
+            break;
+        }
+        n += std::size_t(ret);
+    }
+    if (n == 0)
+    {
+        return false;
+    }
+    data = begin;
+    size = n;
+    return true;
+}
+#endif
@@ -0,0 +1,124 @@
+
+#include <cstring>
+#include <algorithm>
+#include <boost/endian/conversion.hpp>
+#include "MessageDecoderImpl.h"
+
+using namespace dbcppp;
+
+std::unique_ptr<MessageDecoder> MessageDecoder::create(std::vector<const Network*> networks)
+{
+    return std::make_unique<MessageDecoderImpl>(std::move(networks));
+}
+
+MessageDecoderImpl::MessageDecoderImpl(std::vector<const Network*>&& networks)
+    : _plans(networks.size())
+{
+    for (std::size_t bus = 0; bus < networks.size(); bus++)
+    {
+        if (!networks[bus])
+        {
+            continue;
+        }
+        networks[bus]->forEachMessage(
+            [&](const Message& msg)
+            {
+                MessagePlan plan;
+                plan.message = &msg;
+                plan.mux_signal = msg.getMuxSignal();
+                plan.n_words = 0;
+                plan.have_previous = false;
+                plan.previous_size = 0;
+                for (std::size_t i = 0; i < msg.signalCount(); i++)
+                {
+                    const Message::Coverage& coverage = *msg.getSignalCoverage(i);
+                    SignalPlan sig_plan{msg.getSignalByIndex(i), plan.coverage.size(), plan.coverage.size()};
+                    for (std::size_t w = 0; w < 8; w++)
+                    {
+                        if (coverage.words[w])
+                        {
+                            plan.coverage.push_back(CoverageWord{w, coverage.words[w]});
+                            plan.n_words = std::max(plan.n_words, w + 1);
+                        }
+                    }
+                    sig_plan.end = plan.coverage.size();
+                    plan.signals.push_back(sig_plan);
+                }
+                _plans[bus].insert(std::make_pair(msg.getId(), std::move(plan)));
+            });
+    }
+}
+void MessageDecoderImpl::decode(const Frame* frames, std::size_t n, const callback_t& cb)
+{
+    _values.clear();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        const Frame& frame = frames[i];
+        if (frame.bus >= _plans.size())
+        {
+            continue;
+        }
+        auto iter = _plans[frame.bus].find(frame.id);
+        if (iter == _plans[frame.bus].end())
+        {
+            continue;
+        }
+        MessagePlan& plan = iter.value();
+        bool all = !plan.have_previous || plan.previous_size != frame.size;
+        uint64_t words[8];
+        uint64_t diff[8];
+        uint64_t any = all;
+        std::memcpy(words, frame.data, sizeof(words));
+        for (std::size_t w = 0; w < plan.n_words; w++)
+        {
+            boost::endian::little_to_native_inplace(words[w]);
+            diff[w] = words[w] ^ plan.previous[w];
+            any |= diff[w];
+            plan.previous[w] = words[w];
+        }
+        plan.have_previous = true;
+        plan.previous_size = frame.size;
+        if (!any)
+        {
+            continue;
+        }
+        uint64_t mux_value = plan.mux_signal ? plan.mux_signal->decode(frame.data) : 0;
+        for (const SignalPlan& sig_plan : plan.signals)
+        {
+            const Signal* sig = sig_plan.signal;
+            if (!all)
+            {
+                uint64_t changed = 0;
+                for (std::size_t j = sig_plan.begin; j < sig_plan.end; j++)
+                {
+                    changed |= diff[plan.coverage[j].word] & plan.coverage[j].bits;
+                }
+                if (!changed)
+                {
+                    continue;
+                }
+            }
+            if (sig->getMultiplexerIndicator() == Signal::Multiplexer::MuxValue &&
+                (!plan.mux_signal || sig->getMultiplexerSwitchValue() != mux_value))
+            {
+                continue;
+            }
+            Signal::raw_t raw = sig->decode(frame.data);
+            _values.push_back(Value{frame.timestamp, frame.bus, plan.message, sig, raw, sig->rawToPhys(raw)});
+        }
+    }
+    if (!_values.empty())
+    {
+        cb(&_values[0], _values.size());
+    }
+}
+void MessageDecoderImpl::reset()
+{
+    for (auto& plans : _plans)
+    {
+        for (auto iter = plans.begin(); iter != plans.end(); ++iter)
+        {
+            iter.value().have_previous = false;
+        }
+    }
+}
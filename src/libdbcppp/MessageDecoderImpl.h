@@ -0,0 +1,51 @@
+
+#pragma once
+
+#include <robin-map/tsl/robin_map.h>
+
+#include "../../include/dbcppp/MessageDecoder.h"
+
+namespace dbcppp
+{
+    class MessageDecoderImpl final
+        : public MessageDecoder
+    {
+    public:
+        MessageDecoderImpl(std::vector<const Network*>&& networks);
+
+        virtual void decode(const Frame* frames, std::size_t n, const callback_t& cb) override;
+        virtual void reset() override;
+
+    private:
+        // the non zero words of a signal's coverage
+        struct CoverageWord
+        {
+            std::size_t word;
+            uint64_t bits;
+        };
+        struct SignalPlan
+        {
+            const Signal* signal;
+            // range in MessagePlan::coverage
+            std::size_t begin;
+            std::size_t end;
+        };
+        struct MessagePlan
+        {
+            const Message* message;
+            const Signal* mux_signal;
+            std::vector<SignalPlan> signals;
+            std::vector<CoverageWord> coverage;
+            // only the words covered by any signal are compared
+            std::size_t n_words;
+
+            // the previous frame
+            bool have_previous;
+            uint8_t previous_size;
+            uint64_t previous[8];
+        };
+
+        std::vector<tsl::robin_map<uint64_t, MessagePlan>> _plans;
+        std::vector<Value> _values;
+    };
+}
@@ -1,6 +1,8 @@
 
+#include <algorithm>
 #include <boost/move/unique_ptr.hpp>
 #include "MessageImpl.h"
+#include "ByteSegments.h"
 
 using namespace dbcppp;
 
@@ -52,23 +54,38 @@ MessageImpl::MessageImpl(
     , _message_size(std::move(message_size))
     , _transmitter(std::move(transmitter))
     , _message_transmitters(std::move(message_transmitters))
-    , _signals(std::move(signals))
     , _attribute_values(std::move(attribute_values))
     , _comment(std::move(comment))
     , _mux_signal(nullptr)
+    , _jit_decode_all(nullptr)
+    , _jit_decode_all_float(nullptr)
     , _error(ErrorCode::NoError)
 {
+    // order the signals by start bit, the map already ordered the ones with the same start bit by name
+    _signals.reserve(signals.size());
+    for (auto& sig : signals)
+    {
+        _signals.push_back(std::move(sig.second));
+    }
+    std::stable_sort(_signals.begin(), _signals.end(),
+        [](const SignalImpl& lhs, const SignalImpl& rhs)
+        {
+            return lhs.getStartBit() < rhs.getStartBit();
+        });
+    for (std::size_t i = 0; i < _signals.size(); i++)
+    {
+        _signals[i].setIndex(i);
+        _signals[i].setGlobalIndex(i);
+        _signal_indices.insert(std::make_pair(_signals[i].getName(), i));
+    }
+    updateSignalRange();
+    updateCoverage();
     bool have_mux_value = false;
     for (const auto& sig : _signals)
     {
-        switch (sig.second.getMultiplexerIndicator())
+        if (sig.getMultiplexerIndicator() == Signal::Multiplexer::MuxValue)
         {
-        case Signal::Multiplexer::MuxValue:
             have_mux_value = true;
-            break;
-        case Signal::Multiplexer::MuxSwitch:
-            _mux_signal = &sig.second;
-            break;
         }
     }
     if (have_mux_value && _mux_signal == nullptr)
@@ -77,6 +94,46 @@ MessageImpl::MessageImpl(
     }
 }
 MessageImpl::MessageImpl(const MessageImpl& other)
+    : _id(other._id)
+    , _name(other._name)
+    , _message_size(other._message_size)
+    , _transmitter(other._transmitter)
+    , _message_transmitters(other._message_transmitters)
+    , _signals(other._signals)
+    , _signal_indices(other._signal_indices)
+    , _coverage(other._coverage)
+    , _attribute_values(other._attribute_values)
+    , _comment(other._comment)
+    , _mux_signal(nullptr)
+    , _jit_decode_all(other._jit_decode_all)
+    , _jit_decode_all_float(other._jit_decode_all_float)
+    , _jit(other._jit)
+    , _error(other._error)
+{
+    updateSignalRange();
+}
+MessageImpl::MessageImpl(MessageImpl&& other)
+    : _id(other._id)
+    , _name(std::move(other._name))
+    , _message_size(other._message_size)
+    , _transmitter(std::move(other._transmitter))
+    , _message_transmitters(std::move(other._message_transmitters))
+    , _signals(std::move(other._signals))
+    , _signal_indices(std::move(other._signal_indices))
+    , _signal_range(std::move(other._signal_range))
+    , _coverage(std::move(other._coverage))
+    , _attribute_values(std::move(other._attribute_values))
+    , _comment(std::move(other._comment))
+    , _mux_signal(other._mux_signal)
+    , _jit_decode_all(other._jit_decode_all)
+    , _jit_decode_all_float(other._jit_decode_all_float)
+    , _jit(std::move(other._jit))
+    , _error(other._error)
+{
+    // the signals stay in place, but their parent moved
+    updateParents();
+}
+MessageImpl& MessageImpl::operator=(const MessageImpl& other)
 {
     _id = other._id;
     _name = other._name;
@@ -84,42 +141,83 @@ MessageImpl::MessageImpl(const MessageImpl& other)
     _transmitter = other._transmitter;
     _message_transmitters = other._message_transmitters;
     _signals = other._signals;
+    _signal_indices = other._signal_indices;
+    _coverage = other._coverage;
     _attribute_values = other._attribute_values;
     _comment = other._comment;
+    _jit_decode_all = other._jit_decode_all;
+    _jit_decode_all_float = other._jit_decode_all_float;
+    _jit = other._jit;
+    _error = other._error;
+    updateSignalRange();
+    return *this;
+}
+MessageImpl& MessageImpl::operator=(MessageImpl&& other)
+{
+    _id = other._id;
+    _name = std::move(other._name);
+    _message_size = other._message_size;
+    _transmitter = std::move(other._transmitter);
+    _message_transmitters = std::move(other._message_transmitters);
+    _signals = std::move(other._signals);
+    _signal_indices = std::move(other._signal_indices);
+    _signal_range = std::move(other._signal_range);
+    _coverage = std::move(other._coverage);
+    _attribute_values = std::move(other._attribute_values);
+    _comment = std::move(other._comment);
+    _mux_signal = other._mux_signal;
+    _jit_decode_all = other._jit_decode_all;
+    _jit_decode_all_float = other._jit_decode_all_float;
+    _jit = std::move(other._jit);
+    _error = other._error;
+    updateParents();
+    return *this;
+}
+void MessageImpl::updateSignalRange()
+{
     _mux_signal = nullptr;
+    _signal_range.clear();
+    _signal_range.reserve(_signals.size());
     for (const auto& sig : _signals)
     {
-        switch (sig.second.getMultiplexerIndicator())
+        _signal_range.push_back(&sig);
+        if (sig.getMultiplexerIndicator() == Signal::Multiplexer::MuxSwitch)
         {
-        case Signal::Multiplexer::MuxSwitch:
-            _mux_signal = &sig.second;
-            break;
+            _mux_signal = &sig;
         }
     }
-    _error = other._error;
+    updateParents();
 }
-MessageImpl& MessageImpl::operator=(const MessageImpl& other)
+void MessageImpl::updateCoverage()
 {
-    _id = other._id;
-    _name = other._name;
-    _message_size = other._message_size;
-    _transmitter = other._transmitter;
-    _message_transmitters = other._message_transmitters;
-    _signals = other._signals;
-    _attribute_values = other._attribute_values;
-    _comment = other._comment;
-    _mux_signal = nullptr;
-    for (const auto& sig : _signals)
+    auto add = [](Coverage& coverage, const Signal& sig)
     {
-        switch (sig.second.getMultiplexerIndicator())
+        for (const auto& seg : byte_segments(sig))
         {
-        case Signal::Multiplexer::MuxSwitch:
-            _mux_signal = &sig.second;
-            break;
+            // bits beyond the largest CAN FD frame can't change
+            if (seg.byte < 64)
+            {
+                uint64_t bits = ((uint64_t(1) << seg.n) - 1) << seg.lo;
+                coverage.words[seg.byte / 8] |= bits << (seg.byte % 8 * 8);
+            }
+        }
+    };
+    _coverage.assign(_signals.size(), Coverage{});
+    for (std::size_t i = 0; i < _signals.size(); i++)
+    {
+        add(_coverage[i], _signals[i]);
+        if (_mux_signal && _signals[i].getMultiplexerIndicator() == Signal::Multiplexer::MuxValue)
+        {
+            add(_coverage[i], *_mux_signal);
         }
     }
-    _error = other._error;
-    return *this;
+}
+void MessageImpl::updateParents()
+{
+    for (auto& sig : _signals)
+    {
+        sig.setParent(this);
+    }
 }
 std::unique_ptr<Message> MessageImpl::clone() const
 {
@@ -143,22 +241,22 @@ const std::string& MessageImpl::getTransmitter() const
 }
 bool MessageImpl::hasMessageTransmitter(const std::string& name) const
 {
-    return _message_transmitters.find(name) != _message_transmitters.end();
+    return _message_transmitters.contains(name);
 }
 void MessageImpl::forEachMessageTransmitter(std::function<void(const std::string&)>&& cb) const
 {
-    for (const auto& n : _message_transmitters)
+    for (const auto* n : _message_transmitters)
     {
-        cb(n);
+        cb(*n);
     }
 }
 const Signal* MessageImpl::getSignalByName(const std::string& name) const
 {
     const Signal* result = nullptr;
-    auto iter = _signals.find(name);
-    if (iter != _signals.end())
+    auto iter = _signal_indices.find(name);
+    if (iter != _signal_indices.end())
     {
-        result = &iter->second;
+        result = &_signals[iter->second];
     }
     return result;
 }
@@ -167,9 +265,9 @@ const Signal* MessageImpl::findSignal(std::function<bool(const Signal&)>&& pred)
     const Signal* result = nullptr;
     for (const auto& s : _signals)
     {
-        if (pred(s.second))
+        if (pred(s))
         {
-            result = &s.second;
+            result = &s;
             break;
         }
     }
@@ -179,27 +277,47 @@ void MessageImpl::forEachSignal(std::function<void(const Signal&)>&& cb) const
 {
     for (const auto& s : _signals)
     {
-        cb(s.second);
+        cb(s);
     }
 }
-const Attribute* MessageImpl::getAttributeValueByName(const std::string& name) const
+Range<Signal> MessageImpl::signals() const
 {
-    const Attribute* result = nullptr;
-    auto iter = _attribute_values.find(name);
-    if (iter != _attribute_values.end())
+    return Range<Signal>(_signal_range.data(), _signal_range.size());
+}
+const Signal* MessageImpl::getSignalByIndex(std::size_t index) const
+{
+    const Signal* result = nullptr;
+    if (index < _signals.size())
     {
-        result = &iter->second;
+        result = &_signals[index];
     }
     return result;
 }
+std::size_t MessageImpl::signalCount() const
+{
+    return _signals.size();
+}
+const Message::Coverage* MessageImpl::getSignalCoverage(std::size_t index) const
+{
+    const Coverage* result = nullptr;
+    if (index < _coverage.size())
+    {
+        result = &_coverage[index];
+    }
+    return result;
+}
+const Attribute* MessageImpl::getAttributeValueByName(const std::string& name) const
+{
+    return _attribute_values.find(name);
+}
 const Attribute* MessageImpl::findAttributeValue(std::function<bool(const Attribute&)>&& pred) const
 {
     const Attribute* result = nullptr;
     for (const auto& av : _attribute_values)
     {
-        if (pred(av.second))
+        if (pred(av))
         {
-            result = &av.second;
+            result = &av;
             break;
         }
     }
@@ -209,7 +327,7 @@ void MessageImpl::forEachAttributeValue(std::function<void(const Attribute&)>&&
 {
     for (const auto& av : _attribute_values)
     {
-        cb(av.second);
+        cb(av);
     }
 }
 const std::string& MessageImpl::getComment() const
@@ -220,12 +338,69 @@ const Signal* MessageImpl::getMuxSignal() const
 {
     return _mux_signal;
 }
+void MessageImpl::decodeAll(const void* bytes, double* values) const
+{
+    if (_jit_decode_all)
+    {
+        _jit_decode_all(bytes, values);
+        return;
+    }
+    Signal::raw_t mux_value = _mux_signal ? _mux_signal->decode(bytes) : 0;
+    for (const auto& sig : _signals)
+    {
+        if (sig.getMultiplexerIndicator() != Signal::Multiplexer::MuxValue ||
+            _mux_signal && sig.getMultiplexerSwitchValue() == mux_value)
+        {
+            *values = sig.rawToPhys(sig.decode(bytes));
+        }
+        values++;
+    }
+}
+void MessageImpl::decodeAll(const void* bytes, float* values) const
+{
+    if (_jit_decode_all_float)
+    {
+        _jit_decode_all_float(bytes, values);
+        return;
+    }
+    Signal::raw_t mux_value = _mux_signal ? _mux_signal->decode(bytes) : 0;
+    for (const auto& sig : _signals)
+    {
+        if (sig.getMultiplexerIndicator() != Signal::Multiplexer::MuxValue ||
+            _mux_signal && sig.getMultiplexerSwitchValue() == mux_value)
+        {
+            *values = sig.rawToPhysFloat(sig.decode(bytes));
+        }
+        values++;
+    }
+}
+bool MessageImpl::isJitCompiled() const
+{
+    return _jit_decode_all != nullptr;
+}
 MessageImpl::ErrorCode MessageImpl::getError() const
 {
     return _error;
 }
 
-const std::map<std::string, SignalImpl>& MessageImpl::signals() const
+const std::vector<SignalImpl>& MessageImpl::signalsByIndex() const
+{
+    return _signals;
+}
+std::vector<SignalImpl>& MessageImpl::signalsByIndex()
 {
     return _signals;
 }
+void MessageImpl::setGlobalIndexOffset(std::size_t offset)
+{
+    for (auto& sig : _signals)
+    {
+        sig.setGlobalIndex(offset + sig.getIndex());
+    }
+}
+void MessageImpl::setJitDecodeAll(decode_all_t decode_all, decode_all_float_t decode_all_float, std::shared_ptr<void> jit)
+{
+    _jit_decode_all = decode_all;
+    _jit_decode_all_float = decode_all_float;
+    _jit = std::move(jit);
+}
@@ -22,9 +22,9 @@ namespace dbcppp
             , std::map<std::string, AttributeImpl>&& attribute_values
             , std::string&& comment);
         MessageImpl(const MessageImpl& other);
-        MessageImpl(MessageImpl&& other) = default;
+        MessageImpl(MessageImpl&& other);
         MessageImpl& operator=(const MessageImpl& other);
-        MessageImpl& operator=(MessageImpl&&) = default;
+        MessageImpl& operator=(MessageImpl&& other);
             
         virtual std::unique_ptr<Message> clone() const override;
 
@@ -37,28 +37,57 @@ namespace dbcppp
         virtual const Signal* getSignalByName(const std::string& name) const override;
         virtual const Signal* findSignal(std::function<bool(const Signal&)>&& pred) const override;
         virtual void forEachSignal(std::function<void(const Signal&)>&& cb) const override;
+        virtual Range<Signal> signals() const override;
+        virtual const Signal* getSignalByIndex(std::size_t index) const override;
+        virtual std::size_t signalCount() const override;
+        virtual const Coverage* getSignalCoverage(std::size_t index) const override;
         virtual const Attribute* getAttributeValueByName(const std::string& name) const override;
         virtual const Attribute* findAttributeValue(std::function<bool(const Attribute&)>&& pred) const override;
         virtual void forEachAttributeValue(std::function<void(const Attribute&)>&& cb) const override;
         virtual const std::string& getComment() const override;
         virtual const Signal* getMuxSignal() const override;
+        virtual void decodeAll(const void* bytes, double* values) const override;
+        virtual void decodeAll(const void* bytes, float* values) const override;
+        virtual bool isJitCompiled() const override;
         
         virtual ErrorCode getError() const override;
         
-        const std::map<std::string, SignalImpl>& signals() const;
+        const std::vector<SignalImpl>& signalsByIndex() const;
+        // for changing the signals in place, the vector itself must not be resized
+        std::vector<SignalImpl>& signalsByIndex();
+        void setGlobalIndexOffset(std::size_t offset);
+
+        using decode_all_t = void (*)(const void* bytes, double* values);
+        using decode_all_float_t = void (*)(const void* bytes, float* values);
+        // jit keeps the compiled code alive as long as a message (or a copy of it) uses it
+        void setJitDecodeAll(decode_all_t decode_all, decode_all_float_t decode_all_float, std::shared_ptr<void> jit);
         
     private:
+        void updateSignalRange();
+        void updateCoverage();
+        void updateParents();
+
         uint64_t _id;
         std::string _name;
         uint64_t _message_size;
         std::string _transmitter;
-        std::set<std::string> _message_transmitters;
-        std::map<std::string, SignalImpl> _signals;
-        std::map<std::string, AttributeImpl> _attribute_values;
+        InternedStringSet _message_transmitters;
+        // ordered by start bit, the position is the signal's index
+        std::vector<SignalImpl> _signals;
+        std::map<std::string, std::size_t> _signal_indices;
+        // backs signals(), has to be rebuilt on copy, moving the vector keeps the signals in place
+        std::vector<const Signal*> _signal_range;
+        // same order as _signals
+        std::vector<Coverage> _coverage;
+        SortedByName<AttributeImpl> _attribute_values;
         std::string _comment;
 
         const Signal* _mux_signal;
 
+        decode_all_t _jit_decode_all;
+        decode_all_float_t _jit_decode_all_float;
+        std::shared_ptr<void> _jit;
+
         ErrorCode _error;
     };
 }
@@ -1,183 +1,386 @@
 
+#include <map>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <cctype>
+#include <algorithm>
+#include <functional>
 #include "NetworkImpl.h"
+#include "ByteSegments.h"
 #include "../../include/dbcppp/Network2Functions.h"
 
 using namespace dbcppp;
 using namespace dbcppp::Network2C;
 
 static const char* header =
-    "#ifndef DBCPPP_BYTE_ORDER_LITTLE_ENDIAN\n"
-    "#error \"Please pass -DDBCPPP_BYTE_ORDER_LITTLE_ENDIAN=<1|0>\"\n"
-    "#endif\n"
+    "/* generated by dbcppp, do not edit */\n"
+    "#ifndef DBCPPP_GENERATED_NETWORK_H\n"
+    "#define DBCPPP_GENERATED_NETWORK_H\n"
     "#include <stdint.h>\n"
-    "#define bswap_16(value) ((((value) & 0xff) << 8) | ((value) >> 8))\n"
-    "#define bswap_32(value) \\\n"
-    "    (((uint32_t)bswap_16((uint16_t)((value) & 0xffff)) << 16) | \\\n"
-    "    (uint32_t)bswap_16((uint16_t)((value) >> 16)))\n"
-    "#define bswap_64(value) \\\n"
-    "    (((uint64_t)bswap_32((uint32_t)((value) & 0xffffffff)) \\\n"
-    "    << 32) | \\\n"
-    "    (uint64_t)bswap_32((uint32_t)((value) >> 32)))\n"
-    "uint64_t dbcppp_native_to_big(uint64_t& v)\n"
-    "{\n"
-    "#if DBCPPP_BYTE_ORDER_LITTLE_ENDIAN == 1\n"
-    "    return bswap_64(v);\n"
-    "#else\n"
-    "    return v;\n"
-    "#endif\n"
+    "#include <string.h>\n"
+    "#ifdef __cplusplus\n"
+    "extern \"C\" {\n"
+    "#endif\n";
+static const char* footer =
+    "#ifdef __cplusplus\n"
     "}\n"
-    "uint64_t dbcppp_native_to_little(uint64_t& v)\n"
-    "{\n"
-    "#if DBCPPP_BYTE_ORDER_LITTLE_ENDIAN == 1\n"
-    "    return v;\n"
-    "#else\n"
-    "    return bswap_64(v);\n"
     "#endif\n"
-    "}\n";
-        
+    "#endif\n";
+
+static std::string c_double(double value)
+{
+    std::ostringstream ss;
+    ss << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+    std::string result = ss.str();
+    if (result.find_first_of(".en") == std::string::npos)
+    {
+        result += ".0";
+    }
+    return result;
+}
+static std::string c_hex(uint64_t value)
+{
+    std::ostringstream ss;
+    ss << "0x" << std::hex << std::uppercase << value << "ull";
+    return ss.str();
+}
+static std::string to_upper(std::string str)
+{
+    std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) { return char(std::toupper(c)); });
+    return str;
+}
+static std::string signal_function_name(const Message& msg, const Signal& sig)
+{
+    return msg.getName() + "_" + std::to_string(msg.getId()) + "_" + sig.getName();
+}
+static void signal_functions(std::ostream& os, const Message& msg, const Signal& sig)
+{
+    auto name = signal_function_name(msg, sig);
+    auto segments = byte_segments(sig);
+    uint64_t bit_size = sig.getBitSize();
+    uint64_t mask = bit_size >= 64 ? ~0ull : (1ull << bit_size) - 1;
+
+    // raw extraction, every byte contributes one constant shift and mask
+    os << boost::format(
+        "static inline uint64_t dbcppp_decode_%1%(const void* nbytes)\n"
+        "{\n"
+        "    const uint8_t* data = (const uint8_t*)nbytes;\n"
+        "    uint64_t raw =")
+        % name;
+    for (std::size_t i = 0; i < segments.size(); i++)
+    {
+        const auto& s = segments[i];
+        std::string term = "data[" + std::to_string(s.byte) + "]";
+        if (s.lo)
+        {
+            term = "(" + term + " >> " + std::to_string(s.lo) + ")";
+        }
+        if (s.lo + s.n < 8)
+        {
+            term = "(" + term + " & " + c_hex((1ull << s.n) - 1) + ")";
+        }
+        term = "(uint64_t)" + term;
+        if (s.raw_pos)
+        {
+            term = "(" + term + " << " + std::to_string(s.raw_pos) + ")";
+        }
+        os << (i ? "\n        | " : " ") << term;
+    }
+    os << ";\n";
+    if (sig.getExtendedValueType() == Signal::ExtendedValueType::Integer &&
+        sig.getValueType() == Signal::ValueType::Signed && bit_size < 64)
+    {
+        os << boost::format(
+            "    if (raw & %1%)\n"
+            "    {\n"
+            "        raw |= %2%;\n"
+            "    }\n")
+            % c_hex(1ull << (bit_size - 1))
+            % c_hex(~mask);
+    }
+    os << "    return raw;\n}\n";
+
+    os << boost::format(
+        "static inline void dbcppp_encode_%1%(uint64_t raw, void* nbytes)\n"
+        "{\n"
+        "    uint8_t* data = (uint8_t*)nbytes;\n")
+        % name;
+    for (const auto& s : segments)
+    {
+        uint64_t byte_mask = ((1ull << s.n) - 1) << s.lo;
+        std::string value = s.raw_pos ? "(raw >> " + std::to_string(s.raw_pos) + ")" : std::string("raw");
+        if (s.lo)
+        {
+            value = "(" + value + " << " + std::to_string(s.lo) + ")";
+        }
+        if (byte_mask == 0xFF)
+        {
+            os << boost::format("    data[%1%] = (uint8_t)%2%;\n") % s.byte % value;
+        }
+        else
+        {
+            os << boost::format("    data[%1%] = (uint8_t)((data[%1%] & 0x%2$02X) | (%3% & 0x%4$02X));\n")
+                % s.byte % (~byte_mask & 0xFF) % value % byte_mask;
+        }
+    }
+    os << "}\n";
+
+    // conversion between raw and physical value, factor and offset are folded in as constants
+    std::string scale;
+    if (sig.getFactor() != 1.)
+    {
+        scale += " * " + c_double(sig.getFactor());
+    }
+    if (sig.getOffset() != 0.)
+    {
+        scale += " + " + c_double(sig.getOffset());
+    }
+    std::string unscale = "phys";
+    if (sig.getOffset() != 0.)
+    {
+        unscale = "(" + unscale + " - " + c_double(sig.getOffset()) + ")";
+    }
+    if (sig.getFactor() != 1.)
+    {
+        unscale = "(" + unscale + " / " + c_double(sig.getFactor()) + ")";
+    }
+    os << boost::format(
+        "static inline double dbcppp_rawToPhys_%1%(uint64_t raw)\n"
+        "{\n")
+        % name;
+    switch (sig.getExtendedValueType())
+    {
+    case Signal::ExtendedValueType::Integer:
+        os << boost::format("    return (double)(%1%)raw%2%;\n")
+            % (sig.getValueType() == Signal::ValueType::Signed ? "int64_t" : "uint64_t")
+            % scale;
+        break;
+    case Signal::ExtendedValueType::Float:
+        os << boost::format(
+            "    uint32_t bits = (uint32_t)raw;\n"
+            "    float value;\n"
+            "    memcpy(&value, &bits, sizeof(value));\n"
+            "    return (double)value%1%;\n")
+            % scale;
+        break;
+    case Signal::ExtendedValueType::Double:
+        os << boost::format(
+            "    double value;\n"
+            "    memcpy(&value, &raw, sizeof(value));\n"
+            "    return value%1%;\n")
+            % scale;
+        break;
+    }
+    os << "}\n";
+    os << boost::format(
+        "static inline uint64_t dbcppp_physToRaw_%1%(double phys)\n"
+        "{\n")
+        % name;
+    switch (sig.getExtendedValueType())
+    {
+    case Signal::ExtendedValueType::Integer:
+        if (sig.getValueType() == Signal::ValueType::Signed)
+        {
+            os << boost::format("    return (uint64_t)(int64_t)%1% & %2%;\n") % unscale % c_hex(mask);
+        }
+        else
+        {
+            os << boost::format("    return (uint64_t)%1% & %2%;\n") % unscale % c_hex(mask);
+        }
+        break;
+    case Signal::ExtendedValueType::Float:
+        os << boost::format(
+            "    float value = (float)%1%;\n"
+            "    uint32_t bits;\n"
+            "    memcpy(&bits, &value, sizeof(bits));\n"
+            "    return bits;\n")
+            % unscale;
+        break;
+    case Signal::ExtendedValueType::Double:
+        os << boost::format(
+            "    double value = %1%;\n"
+            "    uint64_t bits;\n"
+            "    memcpy(&bits, &value, sizeof(bits));\n"
+            "    return bits;\n")
+            % unscale;
+        break;
+    }
+    os << "}\n";
+}
+// calls emit(sig) for the signals which are always present and groups the multiplexed signals by switch value
+static void mux_branches(
+      std::ostream& os
+    , const Message& msg
+    , const std::function<void(const Signal&, const char* indent)>& emit)
+{
+    std::map<uint64_t, std::vector<const Signal*>> muxed;
+    msg.forEachSignal(
+        [&](const Signal& sig)
+        {
+            if (sig.getMultiplexerIndicator() == Signal::Multiplexer::MuxValue)
+            {
+                muxed[sig.getMultiplexerSwitchValue()].push_back(&sig);
+            }
+            else
+            {
+                emit(sig, "    ");
+            }
+        });
+    const Signal* mux_sig = msg.getMuxSignal();
+    if (!mux_sig || muxed.empty())
+    {
+        return;
+    }
+    os << boost::format("    switch (dbcppp_decode_%1%(data))\n    {\n") % signal_function_name(msg, *mux_sig);
+    for (const auto& branch : muxed)
+    {
+        os << boost::format("    case %1%:\n") % branch.first;
+        for (const Signal* sig : branch.second)
+        {
+            emit(*sig, "        ");
+        }
+        os << "        break;\n";
+    }
+    os << "    }\n";
+}
+
 DBCPPP_API std::ostream& dbcppp::Network2C::operator<<(std::ostream& os, const Network& net)
 {
-    os << boost::format(header);
+    // generate the messages ordered by id, so the output is stable
+    std::vector<const Message*> messages;
     net.forEachMessage(
         [&](const Message& msg)
         {
-            msg.forEachSignal(
-                [&](const Signal& sig)
+            messages.push_back(&msg);
+        });
+    std::sort(messages.begin(), messages.end(),
+        [](const Message* lhs, const Message* rhs)
+        {
+            return lhs->getId() < rhs->getId();
+        });
+
+    os << boost::format(header);
+    for (const Message* msg : messages)
+    {
+        auto upper = to_upper(msg->getName());
+        os << boost::format(
+            "\n/* %1% */\n"
+            "#define DBCPPP_%2%_ID %3%u\n"
+            "#define DBCPPP_%2%_SIZE %4%u\n")
+            % msg->getName() % upper % msg->getId() % msg->getMessageSize();
+        msg->forEachSignal(
+            [&](const Signal& sig)
+            {
+                signal_functions(os, *msg, sig);
+            });
+        os << "typedef struct\n{\n";
+        bool empty = true;
+        msg->forEachSignal(
+            [&](const Signal& sig)
+            {
+                empty = false;
+                os << boost::format("    double %1%;") % sig.getName();
+                if (!sig.getUnit().empty())
                 {
-                    const SignalImpl& sigi = static_cast<const SignalImpl&>(sig);
-                    os << boost::format(
-                        "uint64_t dbcppp_decode_%s(const void* nbytes)\n"
-                        "{\n"
-                        "    uint64_t data;\n")
-                        % (msg.getName() + "_" + std::to_string(msg.getId()) + "_" + sig.getName());
-                            
-                    uint64_t nbytes;
-                    if (sigi.getByteOrder() == Signal::ByteOrder::LittleEndian)
-                    {
-                        nbytes = (sigi.getStartBit() % 8 + sigi.getBitSize() + 7) / 8;
-                    }
-                    else
-                    {
-                        nbytes = (sigi.getBitSize() + (7 - sigi.getStartBit() % 8) + 7) / 8;
-                    }
-                    if (sigi._byte_pos + nbytes <= 8 || nbytes <= 8)
-                    {
-                        // Alignment::size_inbetween_first_64_bit; or
-                        // Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit;
-                        if (sigi._byte_pos + nbytes <= 8)
-                        {
-                            os << boost::format("    data = *reinterpret_cast<const uint64_t*>(nbytes);\n");
-                        }
-                        else
-                        {
-                            os << boost::format(
-                                "data = *reinterpret_cast<const uint64_t*>(&reinterpret_cast<const uint8_t*>(nbytes)[%1%]);\n")
-                                % sigi._byte_pos;
-                        }
-                        if (sig.getByteOrder() == Signal::ByteOrder::BigEndian)
-                        {
-                            os << boost::format("    data = dbcppp_native_to_big(data);\n");
-                        }
-                        else
-                        {
-                            os << boost::format("    data = dbcppp_native_to_little(data);\n");
-                        }
-                        if (sig.getExtendedValueType() == Signal::ExtendedValueType::Double)
-                        {
-                            os << boost::format("    return data;\n");
-                        }
-                        else
-                        {
-                            os << boost::format("    data >>= %1%ull;\n")
-                                % sigi._fixed_start_bit_0;
-                            if (sig.getExtendedValueType() != Signal::ExtendedValueType::Float)
-                            {
-                                os << boost::format("    data &= %1%ull;\n") % sigi._mask;
-                                if (sig.getValueType() == Signal::ValueType::Signed)
-                                {
-                                    os << boost::format(
-                                        "    if (data & %1%ull)\n"
-                                        "    {\n"
-                                        "        data |= %1%ull;\n"
-                                        "    }\n"
-                                        "    return data;\n")
-                                        % sigi._mask_signed;
-                                }
-                            }
-                            os << boost::format("    return data;\n");
-                        }
-                    }
-                    else
-                    {
-                        // Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit;
-                        os << boost::format(
-                            "    hack.ui = *reinterpret_cast<const uint64_t*>(&reinterpret_cast<const uint8_t*>(nbytes)[%1%]);\n")
-                            % sigi._byte_pos;
-                        os << boost::format(
-                            "    uint64_t data1 = reinterpret_cast<const uint8_t*>(nbytes)[%1% + 8];\n")
-                            % sigi._byte_pos;
-                        if (sig.getByteOrder() == Signal::ByteOrder::BigEndian)
-                        {
-                            os << boost::format(
-                                "    data = dbcppp_native_to_big(data);\n"
-                                "    data &= %1%ull;\n"
-                                "    data <<= %2%ull;\n"
-                                "    data1 >>= %3%ull;\n"
-                                "    data |= data1;\n")
-                                % sigi._mask
-                                % sigi._fixed_start_bit_0
-                                % sigi._fixed_start_bit_1;
-                        }
-                        else
-                        {
-                            os << boost::format(
-                                "    data = dbcppp_native_to_little(data);\n"
-                                "    data >>= %1%ull;\n"
-                                "    data1 &= %2%ull;\n"
-                                "    data1 <<= %3%ull;\n"
-                                "    data |= data1;)\n")
-                                % sigi._fixed_start_bit_0
-                                % sigi._mask
-                                % sigi._fixed_start_bit_1;
-                        }
-                        switch (sig.getExtendedValueType())
-                        {
-                        case Signal::ExtendedValueType::Integer:
-                            if (sig.getValueType() == Signal::ValueType::Signed)
-                            {
-                                os << boost::format(
-                                    "    if (data & %1%ull)\n"
-                                    "    {\n"
-                                    "        data |= %1%ull;\n"
-                                    "    }\n"
-                                    "    return data;\n")
-                                    % sigi._mask_signed;
-                                os << boost::format("    return data;\n");
-                            }
-                            else
-                            {
-                                os << boost::format("    return data;\n");
-                            }
-                            break;
-                        case Signal::ExtendedValueType::Float:
-                            os << boost::format("    return data;\n");
-                            break;
-                        case Signal::ExtendedValueType::Double:
-                            os << boost::format("    return data;\n");
-                            break;
-                        }
-                    }
-                    os << boost::format("}\n");
-                    os << boost::format(
-                        "double dbcppp_rawToPhys_%1%(uint64_t value)\n"
-                        "{\n"
-                        "    return value * %2% + %3%;\n"
-                        "}\n")
-                        % (msg.getName() + "_" + std::to_string(msg.getId()) + "_" + sig.getName())
-                        % sig.getFactor()
-                        % sig.getOffset();
-                });
+                    os << boost::format(" /* %1% */") % sig.getUnit();
+                }
+                os << "\n";
+            });
+        if (empty)
+        {
+            // C doesn't allow empty structs
+            os << "    uint8_t unused;\n";
+        }
+        os << boost::format("} dbcppp_%1%_t;\n") % msg->getName();
 
-        });
+        os << boost::format(
+            "/* multiplexed signals are only written if they are active, the others keep their value */\n"
+            "static inline void dbcppp_%1%_unpack(dbcppp_%1%_t* msg, const uint8_t* data)\n"
+            "{\n")
+            % msg->getName();
+        if (empty)
+        {
+            os << "    (void)msg;\n    (void)data;\n";
+        }
+        mux_branches(os, *msg,
+            [&](const Signal& sig, const char* indent)
+            {
+                auto name = signal_function_name(*msg, sig);
+                os << boost::format("%1%msg->%2% = dbcppp_rawToPhys_%3%(dbcppp_decode_%3%(data));\n")
+                    % indent % sig.getName() % name;
+            });
+        os << "}\n";
+        os << boost::format(
+            "static inline void dbcppp_%1%_pack(const dbcppp_%1%_t* msg, uint8_t* data)\n"
+            "{\n"
+            "    memset(data, 0, DBCPPP_%2%_SIZE);\n")
+            % msg->getName() % upper;
+        if (empty)
+        {
+            os << "    (void)msg;\n";
+        }
+        mux_branches(os, *msg,
+            [&](const Signal& sig, const char* indent)
+            {
+                auto name = signal_function_name(*msg, sig);
+                os << boost::format("%1%dbcppp_encode_%3%(dbcppp_physToRaw_%3%(msg->%2%), data);\n")
+                    % indent % sig.getName() % name;
+            });
+        os << "}\n";
+    }
+
+    os << "\ntypedef union\n{\n";
+    for (const Message* msg : messages)
+    {
+        os << boost::format("    dbcppp_%1%_t %1%;\n") % msg->getName();
+    }
+    if (messages.empty())
+    {
+        os << "    uint8_t unused;\n";
+    }
+    os << "} dbcppp_message_t;\n";
+    os <<
+        "/* returns 0 on success, -1 if the id is unknown or the data is shorter than the message */\n"
+        "static inline int dbcppp_unpack(uint32_t id, const uint8_t* data, uint32_t size, dbcppp_message_t* msg)\n"
+        "{\n"
+        "    switch (id)\n"
+        "    {\n";
+    for (const Message* msg : messages)
+    {
+        os << boost::format(
+            "    case DBCPPP_%1%_ID:\n"
+            "        if (size < DBCPPP_%1%_SIZE) return -1;\n"
+            "        dbcppp_%2%_unpack(&msg->%2%, data);\n"
+            "        return 0;\n")
+            % to_upper(msg->getName()) % msg->getName();
+    }
+    os <<
+        "    }\n"
+        "    (void)data;\n"
+        "    (void)size;\n"
+        "    (void)msg;\n"
+        "    return -1;\n"
+        "}\n"
+        "/* returns the size of the packed message, -1 if the id is unknown */\n"
+        "static inline int dbcppp_pack(uint32_t id, const dbcppp_message_t* msg, uint8_t* data)\n"
+        "{\n"
+        "    switch (id)\n"
+        "    {\n";
+    for (const Message* msg : messages)
+    {
+        os << boost::format(
+            "    case DBCPPP_%1%_ID:\n"
+            "        dbcppp_%2%_pack(&msg->%2%, data);\n"
+            "        return DBCPPP_%1%_SIZE;\n")
+            % to_upper(msg->getName()) % msg->getName();
+    }
+    os <<
+        "    }\n"
+        "    (void)msg;\n"
+        "    (void)data;\n"
+        "    return -1;\n"
+        "}\n";
+    os << boost::format(footer);
     return os;
 }
@@ -0,0 +1,462 @@
+
+#include <map>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <functional>
+#include "SignalImpl.h"
+#include "NetworkImpl.h"
+#include "../../include/dbcppp/Network2Functions.h"
+
+using namespace dbcppp;
+using namespace dbcppp::Network2Cpp;
+
+// the decode template mirrors template_decode in SignalImpl.cpp, but takes the layout from the signal type
+// instead of the SignalImpl members, so every shift and mask is a compile-time constant
+static const char* header = R"(// generated by dbcppp, do not edit
+#pragma once
+
+#include <tuple>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+namespace dbcppp
+{
+namespace generated
+{
+    enum class Alignment
+    {
+        size_inbetween_first_64_bit,
+        signal_exceeds_64_bit_size_but_signal_fits_into_64_bit,
+        signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit
+    };
+    enum class ByteOrder { BigEndian, LittleEndian };
+    enum class ValueType { Signed, Unsigned };
+    enum class ExtendedValueType { Integer, Float, Double };
+    enum class Multiplexer { NoMux, MuxSwitch, MuxValue };
+
+    // byte order independent 64 bit load/store, compilers turn them into a single (byte swapping) move
+    template <ByteOrder aByteOrder>
+    constexpr uint64_t load(const uint8_t* data) noexcept
+    {
+        if constexpr (aByteOrder == ByteOrder::BigEndian)
+        {
+            return uint64_t(data[0]) << 56 | uint64_t(data[1]) << 48 | uint64_t(data[2]) << 40 | uint64_t(data[3]) << 32
+                | uint64_t(data[4]) << 24 | uint64_t(data[5]) << 16 | uint64_t(data[6]) << 8 | uint64_t(data[7]);
+        }
+        else
+        {
+            return uint64_t(data[0]) | uint64_t(data[1]) << 8 | uint64_t(data[2]) << 16 | uint64_t(data[3]) << 24
+                | uint64_t(data[4]) << 32 | uint64_t(data[5]) << 40 | uint64_t(data[6]) << 48 | uint64_t(data[7]) << 56;
+        }
+    }
+    template <ByteOrder aByteOrder>
+    constexpr void store(uint64_t value, uint8_t* data) noexcept
+    {
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            data[i] = uint8_t(value >> (aByteOrder == ByteOrder::BigEndian ? 8 * (7 - i) : 8 * i));
+        }
+    }
+
+    // like dbcppp::Signal::decode, data must be readable up to 8 bytes behind the signal's first byte
+    template <class Sig>
+    constexpr uint64_t decode(const uint8_t* data) noexcept
+    {
+        uint64_t raw;
+        if constexpr (Sig::alignment == Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit)
+        {
+            raw = load<Sig::byte_order>(data + Sig::byte_pos);
+            uint64_t raw1 = data[Sig::byte_pos + 8];
+            if constexpr (Sig::byte_order == ByteOrder::BigEndian)
+            {
+                raw = (raw & Sig::mask) << Sig::fixed_start_bit_0 | raw1 >> Sig::fixed_start_bit_1;
+            }
+            else
+            {
+                raw = raw >> Sig::fixed_start_bit_0 | (raw1 & Sig::mask) << Sig::fixed_start_bit_1;
+            }
+        }
+        else
+        {
+            if constexpr (Sig::alignment == Alignment::size_inbetween_first_64_bit)
+            {
+                raw = load<Sig::byte_order>(data);
+            }
+            else
+            {
+                raw = load<Sig::byte_order>(data + Sig::byte_pos);
+            }
+            if constexpr (Sig::extended_value_type == ExtendedValueType::Double)
+            {
+                return raw;
+            }
+            raw = raw >> Sig::fixed_start_bit_0 & Sig::mask;
+        }
+        if constexpr (Sig::extended_value_type == ExtendedValueType::Integer && Sig::value_type == ValueType::Signed)
+        {
+            if (raw & Sig::mask_signed)
+            {
+                raw |= Sig::mask_signed;
+            }
+        }
+        return raw;
+    }
+    template <class Sig>
+    constexpr void encode(uint64_t raw, uint8_t* data) noexcept
+    {
+        if constexpr (Sig::alignment == Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit)
+        {
+            // rare enough (CAN FD only) to go bit by bit like dbcppp::Signal::encode
+            uint64_t src = Sig::start_bit;
+            if constexpr (Sig::byte_order == ByteOrder::BigEndian)
+            {
+                for (uint64_t i = 0; i < Sig::bit_size; i++)
+                {
+                    uint64_t bit = raw >> (Sig::bit_size - i - 1) & 1;
+                    data[src / 8] = uint8_t((data[src / 8] & ~(1u << src % 8)) | bit << src % 8);
+                    src = src % 8 == 0 ? src + 15 : src - 1;
+                }
+            }
+            else
+            {
+                for (uint64_t i = 0; i < Sig::bit_size; i++, src++)
+                {
+                    uint64_t bit = raw >> i & 1;
+                    data[src / 8] = uint8_t((data[src / 8] & ~(1u << src % 8)) | bit << src % 8);
+                }
+            }
+        }
+        else
+        {
+            constexpr std::size_t byte_pos = Sig::alignment == Alignment::size_inbetween_first_64_bit ? 0 : Sig::byte_pos;
+            constexpr uint64_t mask = Sig::mask << Sig::fixed_start_bit_0;
+            uint64_t word = load<Sig::byte_order>(data + byte_pos);
+            word = (word & ~mask) | ((raw << Sig::fixed_start_bit_0) & mask);
+            store<Sig::byte_order>(word, data + byte_pos);
+        }
+    }
+    template <class Sig>
+    inline double raw_to_phys(uint64_t raw) noexcept
+    {
+        double value;
+        if constexpr (Sig::extended_value_type == ExtendedValueType::Float)
+        {
+            uint32_t bits = uint32_t(raw);
+            float f;
+            std::memcpy(&f, &bits, sizeof(f));
+            value = f;
+        }
+        else if constexpr (Sig::extended_value_type == ExtendedValueType::Double)
+        {
+            std::memcpy(&value, &raw, sizeof(value));
+        }
+        else if constexpr (Sig::value_type == ValueType::Signed)
+        {
+            value = double(int64_t(raw));
+        }
+        else
+        {
+            value = double(raw);
+        }
+        if constexpr (Sig::factor != 1.)
+        {
+            value *= Sig::factor;
+        }
+        if constexpr (Sig::offset != 0.)
+        {
+            value += Sig::offset;
+        }
+        return value;
+    }
+    template <class Sig>
+    inline uint64_t phys_to_raw(double phys) noexcept
+    {
+        if constexpr (Sig::offset != 0.)
+        {
+            phys -= Sig::offset;
+        }
+        if constexpr (Sig::factor != 1.)
+        {
+            phys /= Sig::factor;
+        }
+        if constexpr (Sig::extended_value_type == ExtendedValueType::Float)
+        {
+            float f = float(phys);
+            uint32_t bits;
+            std::memcpy(&bits, &f, sizeof(bits));
+            return bits;
+        }
+        else if constexpr (Sig::extended_value_type == ExtendedValueType::Double)
+        {
+            uint64_t bits;
+            std::memcpy(&bits, &phys, sizeof(bits));
+            return bits;
+        }
+        else if constexpr (Sig::value_type == ValueType::Signed)
+        {
+            return uint64_t(int64_t(phys));
+        }
+        else
+        {
+            return uint64_t(phys);
+        }
+    }
+
+    // maps a CAN ID to its message type at compile time
+    template <uint64_t aId>
+    struct message_by_id;
+)";
+static const char* footer = R"(}
+}
+)";
+
+static std::string cpp_double(double value)
+{
+    std::ostringstream ss;
+    ss << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+    std::string result = ss.str();
+    if (result == "inf" || result == "-inf")
+    {
+        return result[0] == '-' ? "-std::numeric_limits<double>::infinity()" : "std::numeric_limits<double>::infinity()";
+    }
+    if (result.find_first_of(".en") == std::string::npos)
+    {
+        result += ".";
+    }
+    return result;
+}
+static const char* alignment_name(Alignment alignment)
+{
+    switch (alignment)
+    {
+    case Alignment::size_inbetween_first_64_bit: return "size_inbetween_first_64_bit";
+    case Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit: return "signal_exceeds_64_bit_size_but_signal_fits_into_64_bit";
+    case Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit: return "signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit";
+    }
+    return "";
+}
+static const char* multiplexer_name(Signal::Multiplexer multiplexer)
+{
+    switch (multiplexer)
+    {
+    case Signal::Multiplexer::NoMux: return "NoMux";
+    case Signal::Multiplexer::MuxSwitch: return "MuxSwitch";
+    case Signal::Multiplexer::MuxValue: return "MuxValue";
+    }
+    return "";
+}
+static const char* extended_value_type_name(Signal::ExtendedValueType extended_value_type)
+{
+    switch (extended_value_type)
+    {
+    case Signal::ExtendedValueType::Integer: return "Integer";
+    case Signal::ExtendedValueType::Float: return "Float";
+    case Signal::ExtendedValueType::Double: return "Double";
+    }
+    return "";
+}
+static void signal_type(std::ostream& os, const Signal& sig)
+{
+    // the layout constants are taken over from the SignalImpl constructor's alignment classification
+    const auto& sigi = static_cast<const SignalImpl&>(sig);
+    os << boost::format(
+        "            struct %1%\n"
+        "            {\n"
+        "                static constexpr const char* name = \"%1%\";\n"
+        "                static constexpr Multiplexer multiplexer_indicator = Multiplexer::%2%;\n"
+        "                static constexpr uint64_t multiplexer_switch_value = %3%ull;\n"
+        "                static constexpr uint64_t start_bit = %4%;\n"
+        "                static constexpr uint64_t bit_size = %5%;\n"
+        "                static constexpr ByteOrder byte_order = ByteOrder::%6%;\n"
+        "                static constexpr ValueType value_type = ValueType::%7%;\n"
+        "                static constexpr ExtendedValueType extended_value_type = ExtendedValueType::%8%;\n"
+        "                static constexpr double factor = %9%;\n"
+        "                static constexpr double offset = %10%;\n"
+        "                static constexpr double minimum = %11%;\n"
+        "                static constexpr double maximum = %12%;\n"
+        "                static constexpr const char* unit = \"%13%\";\n"
+        "                static constexpr Alignment alignment = Alignment::%14%;\n"
+        "                static constexpr uint64_t mask = 0x%15$Xull;\n"
+        "                static constexpr uint64_t mask_signed = 0x%16$Xull;\n"
+        "                static constexpr uint64_t fixed_start_bit_0 = %17%;\n"
+        "                static constexpr uint64_t fixed_start_bit_1 = %18%;\n"
+        "                static constexpr uint64_t byte_pos = %19%;\n"
+        "            };\n")
+        % sig.getName()
+        % multiplexer_name(sig.getMultiplexerIndicator())
+        % sig.getMultiplexerSwitchValue()
+        % sig.getStartBit()
+        % sig.getBitSize()
+        % (sig.getByteOrder() == Signal::ByteOrder::BigEndian ? "BigEndian" : "LittleEndian")
+        % (sig.getValueType() == Signal::ValueType::Signed ? "Signed" : "Unsigned")
+        % extended_value_type_name(sig.getExtendedValueType())
+        % cpp_double(sig.getFactor())
+        % cpp_double(sig.getOffset())
+        % cpp_double(sig.getMinimum())
+        % cpp_double(sig.getMaximum())
+        % sig.getUnit()
+        % alignment_name(sigi._alignment)
+        % sigi._mask
+        % sigi._mask_signed
+        % (sigi._alignment == Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit ||
+            sig.getExtendedValueType() != Signal::ExtendedValueType::Double ? sigi._fixed_start_bit_0 : 0)
+        % (sigi._alignment == Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit ? sigi._fixed_start_bit_1 : 0)
+        % sigi._byte_pos;
+}
+// calls emit(sig) for the signals which are always present and groups the multiplexed signals by switch value
+static void mux_branches(
+      std::ostream& os
+    , const Message& msg
+    , const std::function<void(const Signal&, const char* indent)>& emit)
+{
+    std::map<uint64_t, std::vector<const Signal*>> muxed;
+    msg.forEachSignal(
+        [&](const Signal& sig)
+        {
+            if (sig.getMultiplexerIndicator() == Signal::Multiplexer::MuxValue)
+            {
+                muxed[sig.getMultiplexerSwitchValue()].push_back(&sig);
+            }
+            else
+            {
+                emit(sig, "            ");
+            }
+        });
+    const Signal* mux_sig = msg.getMuxSignal();
+    if (!mux_sig || muxed.empty())
+    {
+        return;
+    }
+    os << boost::format("            switch (decode<signals::%1%>(data))\n            {\n") % mux_sig->getName();
+    for (const auto& branch : muxed)
+    {
+        os << boost::format("            case %1%:\n") % branch.first;
+        for (const Signal* sig : branch.second)
+        {
+            emit(*sig, "                ");
+        }
+        os << "                break;\n";
+    }
+    os << "            }\n";
+}
+
+DBCPPP_API std::ostream& dbcppp::Network2Cpp::operator<<(std::ostream& os, const Network& net)
+{
+    std::vector<const Message*> messages;
+    net.forEachMessage(
+        [&](const Message& msg)
+        {
+            messages.push_back(&msg);
+        });
+    std::sort(messages.begin(), messages.end(),
+        [](const Message* lhs, const Message* rhs)
+        {
+            return lhs->getId() < rhs->getId();
+        });
+
+    os << header;
+    for (const Message* msg : messages)
+    {
+        std::vector<const Signal*> signals;
+        msg->forEachSignal(
+            [&](const Signal& sig)
+            {
+                signals.push_back(&sig);
+            });
+        os << boost::format(
+            "\n"
+            "    struct %1%\n"
+            "    {\n"
+            "        static constexpr const char* name = \"%1%\";\n"
+            "        static constexpr uint64_t id = %2%ull;\n"
+            "        static constexpr uint64_t size = %3%;\n"
+            "        struct signals\n"
+            "        {\n")
+            % msg->getName() % msg->getId() % msg->getMessageSize();
+        for (const Signal* sig : signals)
+        {
+            signal_type(os, *sig);
+        }
+        os << "        };\n";
+        os << "        using signal_types = std::tuple<";
+        for (std::size_t i = 0; i < signals.size(); i++)
+        {
+            os << (i ? ", " : "") << "signals::" << signals[i]->getName();
+        }
+        os << ">;\n";
+        os << "        struct values\n        {\n";
+        for (const Signal* sig : signals)
+        {
+            os << boost::format("            double %1% = 0.;\n") % sig->getName();
+        }
+        os << "        };\n";
+        os <<
+            "        // multiplexed signals are only written if they are active, the others keep their value\n"
+            "        static void unpack(const uint8_t* data, values& v) noexcept\n"
+            "        {\n";
+        if (signals.empty())
+        {
+            os << "            (void)data;\n            (void)v;\n";
+        }
+        mux_branches(os, *msg,
+            [&](const Signal& sig, const char* indent)
+            {
+                os << boost::format("%1%v.%2% = raw_to_phys<signals::%2%>(decode<signals::%2%>(data));\n")
+                    % indent % sig.getName();
+            });
+        os <<
+            "        }\n"
+            "        // data is cleared first, like for decode it must be readable/writable up to 8 bytes behind the last signal's first byte\n"
+            "        static void pack(const values& v, uint8_t* data) noexcept\n"
+            "        {\n"
+            "            std::memset(data, 0, size);\n";
+        if (signals.empty())
+        {
+            os << "            (void)v;\n";
+        }
+        mux_branches(os, *msg,
+            [&](const Signal& sig, const char* indent)
+            {
+                os << boost::format("%1%encode<signals::%2%>(phys_to_raw<signals::%2%>(v.%2%), data);\n")
+                    % indent % sig.getName();
+            });
+        os <<
+            "        }\n"
+            "    };\n";
+        os << boost::format(
+            "    template <>\n"
+            "    struct message_by_id<%1%ull>\n"
+            "    {\n"
+            "        using type = %2%;\n"
+            "    };\n")
+            % msg->getId() % msg->getName();
+    }
+    os << "\n    using message_types = std::tuple<";
+    for (std::size_t i = 0; i < messages.size(); i++)
+    {
+        os << (i ? ", " : "") << messages[i]->getName();
+    }
+    os << ">;\n";
+    os <<
+        "    // calls f(Message{}) with the message type of the ID, returns false if the ID is unknown\n"
+        "    template <class F>\n"
+        "    inline bool visit(uint64_t id, F&& f)\n"
+        "    {\n"
+        "        switch (id)\n"
+        "        {\n";
+    for (const Message* msg : messages)
+    {
+        os << boost::format("        case %1%::id: f(%1%{}); return true;\n") % msg->getName();
+    }
+    os <<
+        "        }\n"
+        "        (void)f;\n"
+        "        return false;\n"
+        "    }\n";
+    os << footer;
+    return os;
+}
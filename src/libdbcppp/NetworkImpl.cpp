@@ -1,5 +1,8 @@
 
+#include <tuple>
+#include <cstring>
 #include <iomanip>
+#include <algorithm>
 #include "../../include/dbcppp/Network.h"
 #include "NetworkImpl.h"
 #include "DBC_Grammar.h"
@@ -101,7 +104,42 @@ NetworkImpl::NetworkImpl(
     , _attribute_defaults(std::move(attribute_defaults))
     , _attribute_values(std::move(attribute_values))
     , _comment(std::move(comment))
-{}
+{
+    updateIndices();
+}
+NetworkImpl::NetworkImpl(const NetworkImpl& other)
+    : _version(other._version)
+    , _new_symbols(other._new_symbols)
+    , _bit_timing(other._bit_timing)
+    , _nodes(other._nodes)
+    , _value_tables(other._value_tables)
+    , _messages(other._messages)
+    , _environment_variables(other._environment_variables)
+    , _attribute_definitions(other._attribute_definitions)
+    , _attribute_defaults(other._attribute_defaults)
+    , _attribute_values(other._attribute_values)
+    , _comment(other._comment)
+    , _bus_names(other._bus_names)
+{
+    updateIndices();
+}
+NetworkImpl& NetworkImpl::operator=(const NetworkImpl& other)
+{
+    _version = other._version;
+    _new_symbols = other._new_symbols;
+    _bit_timing = other._bit_timing;
+    _nodes = other._nodes;
+    _value_tables = other._value_tables;
+    _messages = other._messages;
+    _environment_variables = other._environment_variables;
+    _attribute_definitions = other._attribute_definitions;
+    _attribute_defaults = other._attribute_defaults;
+    _attribute_values = other._attribute_values;
+    _comment = other._comment;
+    _bus_names = other._bus_names;
+    updateIndices();
+    return *this;
+}
 std::unique_ptr<Network> NetworkImpl::clone() const
 {
     return std::make_unique<NetworkImpl>(*this);
@@ -210,10 +248,47 @@ const Message* NetworkImpl::findMessage(std::function<bool(const Message&)>&& pr
 }
 void NetworkImpl::forEachMessage(std::function<void(const Message&)>&& cb) const
 {
-    for (const auto& m : _messages)
+    for (const Message* m : _message_range)
+    {
+        cb(*m);
+    }
+}
+Range<Message> NetworkImpl::messages() const
+{
+    return Range<Message>(_message_range.data(), _message_range.size());
+}
+const Signal* NetworkImpl::getSignalByGlobalIndex(std::size_t index) const
+{
+    const Signal* result = nullptr;
+    if (index < _signal_range.size())
+    {
+        result = _signal_range[index];
+    }
+    return result;
+}
+std::size_t NetworkImpl::signalCount() const
+{
+    return _signal_range.size();
+}
+const Signal* NetworkImpl::getSignalByQualifiedName(const std::string& name) const
+{
+    const Signal* result = nullptr;
+    auto iter = _signals_by_qualified_name.find(name);
+    if (iter != _signals_by_qualified_name.end())
+    {
+        result = iter->second;
+    }
+    return result;
+}
+std::vector<const Signal*> NetworkImpl::getSignalsByQualifiedNames(const std::vector<std::string>& names) const
+{
+    std::vector<const Signal*> result;
+    result.reserve(names.size());
+    for (const auto& name : names)
     {
-        cb(m.second);
+        result.push_back(getSignalByQualifiedName(name));
     }
+    return result;
 }
 const EnvironmentVariable* NetworkImpl::getEnvironmentVariableByName(const std::string& name) const
 {
@@ -341,18 +416,13 @@ const std::string& NetworkImpl::getComment() const
 }
 const Message* NetworkImpl::findParentMessage(const Signal* sig) const
 {
-    const Message* result = nullptr;
-    for (const auto& p : _messages)
+    // the back-pointer is only trusted if the parent is a message of this network
+    const Message* parent = static_cast<const SignalImpl*>(sig)->getParent();
+    if (parent && getMessageById(parent->getId()) == parent)
     {
-        const MessageImpl& msg = p.second;
-        auto iter = msg.signals().find(sig->getName());
-        if (iter != msg.signals().end() && &iter->second == sig)
-        {
-            result = &msg;
-            break;
-        }
+        return parent;
     }
-    return result;
+    return nullptr;
 }
 std::string& NetworkImpl::version()
 {
@@ -374,10 +444,50 @@ std::map<std::string, ValueTableImpl>& NetworkImpl::valueTables()
 {
     return _value_tables;
 }
-tsl::robin_map<uint64_t, MessageImpl>& NetworkImpl::messages()
+tsl::robin_map<uint64_t, MessageImpl>& NetworkImpl::messagesById()
 {
     return _messages;
 }
+void NetworkImpl::updateIndices()
+{
+    std::vector<MessageImpl*> messages;
+    messages.reserve(_messages.size());
+    for (auto iter = _messages.begin(); iter != _messages.end(); ++iter)
+    {
+        messages.push_back(&iter.value());
+    }
+    std::sort(messages.begin(), messages.end(),
+        [](const MessageImpl* lhs, const MessageImpl* rhs)
+        {
+            return lhs->getId() < rhs->getId();
+        });
+    _message_range.assign(messages.begin(), messages.end());
+    _signal_range.clear();
+    _signals_by_qualified_name.clear();
+    auto add = [&](std::string&& name, const Signal* sig)
+    {
+        auto result = _signals_by_qualified_name.insert(std::make_pair(std::move(name), sig));
+        if (!result.second)
+        {
+            result.first.value() = nullptr;
+        }
+    };
+    for (MessageImpl* msg : messages)
+    {
+        msg->setGlobalIndexOffset(_signal_range.size());
+        auto bus = _bus_names.find(msg->getId());
+        for (const Signal& sig : msg->signals())
+        {
+            _signal_range.push_back(&sig);
+            add(std::string(sig.getName()), &sig);
+            add(msg->getName() + "." + sig.getName(), &sig);
+            if (bus != _bus_names.end())
+            {
+                add(bus->second + "." + msg->getName() + "." + sig.getName(), &sig);
+            }
+        }
+    }
+}
 std::map<std::string, EnvironmentVariableImpl>& NetworkImpl::environmentVariables()
 {
     return _environment_variables;
@@ -398,7 +508,15 @@ std::string& NetworkImpl::comment()
 {
     return _comment;
 }
+tsl::robin_map<uint64_t, std::string>& NetworkImpl::busNames()
+{
+    return _bus_names;
+}
 void Network::merge(std::unique_ptr<Network>&& other)
+{
+    merge(std::move(other), "");
+}
+void Network::merge(std::unique_ptr<Network>&& other, const std::string& bus)
 {
     auto& self = static_cast<NetworkImpl&>(*this);
     auto& o = static_cast<NetworkImpl&>(*other);
@@ -414,9 +532,22 @@ void Network::merge(std::unique_ptr<Network>&& other)
     {
         self.valueTables().insert(std::move(vt));
     }
-    for (auto& m : o.messages())
+    for (auto& m : o.messagesById())
     {
-        self.messages().insert(std::move(m));
+        uint64_t id = m.first;
+        if (self.messagesById().insert(std::move(m)).second)
+        {
+            // messages which were merged into other before keep their bus
+            auto other_bus = o.busNames().find(id);
+            if (other_bus != o.busNames().end())
+            {
+                self.busNames()[id] = other_bus->second;
+            }
+            else if (!bus.empty())
+            {
+                self.busNames()[id] = bus;
+            }
+        }
     }
     for (auto& ev : o.environmentVariables())
     {
@@ -434,8 +565,57 @@ void Network::merge(std::unique_ptr<Network>&& other)
     {
         self.attributeValues().insert(std::move(av));
     }
+    self.updateIndices();
     other.reset(nullptr);
 }
+std::size_t Network::buildPhysTables(std::size_t max_bit_size, std::size_t memory_budget)
+{
+    auto& self = static_cast<NetworkImpl&>(*this);
+    std::vector<SignalImpl*> signals;
+    for (auto iter = self.messagesById().begin(); iter != self.messagesById().end(); ++iter)
+    {
+        for (auto& sig : iter.value().signalsByIndex())
+        {
+            if (sig.getExtendedValueType() == Signal::ExtendedValueType::Integer &&
+                sig.getBitSize() <= std::min<std::size_t>(max_bit_size, 32))
+            {
+                signals.push_back(&sig);
+            }
+        }
+    }
+    std::stable_sort(signals.begin(), signals.end(),
+        [](const SignalImpl* lhs, const SignalImpl* rhs)
+        {
+            return lhs->getBitSize() < rhs->getBitSize();
+        });
+    // factor and offset are compared bitwise, equal keys yield bitwise equal tables
+    auto bits = [](double d)
+    {
+        uint64_t result;
+        std::memcpy(&result, &d, sizeof(result));
+        return result;
+    };
+    using key_t = std::tuple<uint64_t, Signal::ValueType, uint64_t, uint64_t>;
+    std::map<key_t, std::shared_ptr<const std::vector<double>>> tables;
+    std::size_t used = 0;
+    for (SignalImpl* sig : signals)
+    {
+        key_t key(sig->getBitSize(), sig->getValueType(), bits(sig->getFactor()), bits(sig->getOffset()));
+        auto iter = tables.find(key);
+        if (iter == tables.end())
+        {
+            std::size_t size = sizeof(double) << sig->getBitSize();
+            if (used + size > memory_budget)
+            {
+                continue;
+            }
+            used += size;
+            iter = tables.insert(std::make_pair(key, sig->makePhysTable())).first;
+        }
+        sig->setPhysTable(iter->second);
+    }
+    return used;
+}
 std::map<std::string, std::unique_ptr<Network>> Network::fromFile(const std::string& filename)
 {
     auto result = std::map<std::string, std::unique_ptr<Network>>();
@@ -29,6 +29,10 @@ namespace dbcppp
             , std::map<std::string, AttributeImpl>&& attribute_defaults
             , std::map<std::string, AttributeImpl>&& attribute_values
             , std::string&& comment);
+        NetworkImpl(const NetworkImpl& other);
+        NetworkImpl(NetworkImpl&& other) = default;
+        NetworkImpl& operator=(const NetworkImpl& other);
+        NetworkImpl& operator=(NetworkImpl&& other) = default;
             
         virtual std::unique_ptr<Network> clone() const override;
 
@@ -45,6 +49,11 @@ namespace dbcppp
         virtual const Message* getMessageById(uint64_t id) const override;
         virtual const Message* findMessage(std::function<bool(const Message&)>&& pred) const override;
         virtual void forEachMessage(std::function<void(const Message&)>&& cb) const override;
+        virtual Range<Message> messages() const override;
+        virtual const Signal* getSignalByGlobalIndex(std::size_t index) const override;
+        virtual std::size_t signalCount() const override;
+        virtual const Signal* getSignalByQualifiedName(const std::string& name) const override;
+        virtual std::vector<const Signal*> getSignalsByQualifiedNames(const std::vector<std::string>& names) const override;
         virtual const EnvironmentVariable* getEnvironmentVariableByName(const std::string& name) const override;
         virtual const EnvironmentVariable* findEnvironmentVariable(std::function<bool(const EnvironmentVariable&)>&& pred) const override;
         virtual void forEachEnvironmentVariable(std::function<void(const EnvironmentVariable&)>&& cb) const override;
@@ -66,12 +75,15 @@ namespace dbcppp
         BitTimingImpl& bitTiming();
         std::map<std::string, NodeImpl>& nodes();
         std::map<std::string, ValueTableImpl>& valueTables();
-        tsl::robin_map<uint64_t, MessageImpl>& messages();
+        tsl::robin_map<uint64_t, MessageImpl>& messagesById();
         std::map<std::string, EnvironmentVariableImpl>& environmentVariables();
         std::map<std::string, AttributeDefinitionImpl>& attributeDefinitions();
         std::map<std::string, AttributeImpl>& attributeDefaults();
         std::map<std::string, AttributeImpl>& attributeValues();
         std::string& comment();
+        tsl::robin_map<uint64_t, std::string>& busNames();
+
+        void updateIndices();
 
     private:
         std::string _version;
@@ -80,10 +92,18 @@ namespace dbcppp
         std::map<std::string, NodeImpl> _nodes;
         std::map<std::string, ValueTableImpl> _value_tables;
         tsl::robin_map<uint64_t, MessageImpl> _messages;
+        // backs messages(), robin_map moves its values on insertion, so this has to be rebuilt whenever _messages changes
+        std::vector<const Message*> _message_range;
+        // the signals of all messages by global index
+        std::vector<const Signal*> _signal_range;
         std::map<std::string, EnvironmentVariableImpl> _environment_variables;
         std::map<std::string, AttributeDefinitionImpl> _attribute_definitions;
         std::map<std::string, AttributeImpl> _attribute_defaults;
         std::map<std::string, AttributeImpl> _attribute_values;
         std::string _comment;
+        // message id -> bus name given to merge
+        tsl::robin_map<uint64_t, std::string> _bus_names;
+        // qualified names -> signal, nullptr for ambiguous names
+        tsl::robin_map<std::string, const Signal*> _signals_by_qualified_name;
     };
 }
@@ -0,0 +1,234 @@
+
+#include "NetworkImpl.h"
+
+#ifdef DBCPPP_HAVE_JIT
+
+#include <mutex>
+#include <vector>
+
+#include <llvm/Config/llvm-config.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/TargetSelect.h>
+
+#include "ByteSegments.h"
+
+using namespace dbcppp;
+
+namespace
+{
+    // raw value like Signal::decode, assembled from single byte loads which LLVM merges again,
+    // so the compiled code never reads outside of the bytes the signal occupies
+    llvm::Value* emit_decode(llvm::IRBuilder<>& builder, llvm::Value* data, const SignalImpl& sig)
+    {
+        llvm::Value* raw = builder.getInt64(0);
+        for (const auto& s : byte_segments(sig))
+        {
+            llvm::Value* byte = builder.CreateLoad(builder.getInt8Ty(),
+                builder.CreateConstInBoundsGEP1_64(builder.getInt8Ty(), data, s.byte));
+            llvm::Value* value = builder.CreateZExt(byte, builder.getInt64Ty());
+            value = builder.CreateLShr(value, s.lo);
+            value = builder.CreateAnd(value, (1ull << s.n) - 1);
+            value = builder.CreateShl(value, s.raw_pos);
+            raw = builder.CreateOr(raw, value);
+        }
+        if (sig.getExtendedValueType() == Signal::ExtendedValueType::Integer &&
+            sig.getValueType() == Signal::ValueType::Signed && sig.getBitSize() < 64)
+        {
+            uint64_t shift = 64 - sig.getBitSize();
+            raw = builder.CreateAShr(builder.CreateShl(raw, shift), shift);
+        }
+        return raw;
+    }
+    // physical value like Signal::rawToPhys
+    llvm::Value* emit_raw_to_phys(llvm::IRBuilder<>& builder, llvm::Value* raw, const SignalImpl& sig)
+    {
+        llvm::Value* value = nullptr;
+        switch (sig.getExtendedValueType())
+        {
+        case Signal::ExtendedValueType::Integer:
+            if (sig.getValueType() == Signal::ValueType::Signed)
+            {
+                value = builder.CreateSIToFP(raw, builder.getDoubleTy());
+            }
+            else
+            {
+                value = builder.CreateUIToFP(raw, builder.getDoubleTy());
+            }
+            break;
+        case Signal::ExtendedValueType::Float:
+            value = builder.CreateBitCast(builder.CreateTrunc(raw, builder.getInt32Ty()), builder.getFloatTy());
+            value = builder.CreateFPExt(value, builder.getDoubleTy());
+            break;
+        case Signal::ExtendedValueType::Double:
+            value = builder.CreateBitCast(raw, builder.getDoubleTy());
+            break;
+        }
+        value = builder.CreateFMul(value, llvm::ConstantFP::get(builder.getDoubleTy(), sig.getFactor()));
+        return builder.CreateFAdd(value, llvm::ConstantFP::get(builder.getDoubleTy(), sig.getOffset()));
+    }
+    // void decode_all(const uint8_t* data, double* values), the multiplexed signals are decoded in a switch over the mux value,
+    // with float_values the values are float like Signal::rawToPhysFloat
+    void emit_decode_all(llvm::Module& module, const std::string& name, const MessageImpl& msg, bool float_values)
+    {
+        auto& ctx = module.getContext();
+        llvm::IRBuilder<> builder(ctx);
+        auto* value_type = float_values ? builder.getFloatTy() : builder.getDoubleTy();
+        auto* data_type = llvm::PointerType::getUnqual(builder.getInt8Ty());
+        auto* values_type = llvm::PointerType::getUnqual(value_type);
+        auto* fn_type = llvm::FunctionType::get(builder.getVoidTy(), {data_type, values_type}, false);
+        auto* fn = llvm::Function::Create(fn_type, llvm::Function::ExternalLinkage, name, module);
+        llvm::Value* data = fn->getArg(0);
+        llvm::Value* values = fn->getArg(1);
+        fn->addParamAttr(0, llvm::Attribute::NoAlias);
+        fn->addParamAttr(1, llvm::Attribute::NoAlias);
+
+        builder.SetInsertPoint(llvm::BasicBlock::Create(ctx, "entry", fn));
+        auto store = [&](const SignalImpl& sig)
+        {
+            llvm::Value* raw = emit_decode(builder, data, sig);
+            llvm::Value* value;
+            if (float_values && sig.getExtendedValueType() == Signal::ExtendedValueType::Float &&
+                sig.getFactor() == 1. && sig.getOffset() == 0.)
+            {
+                value = builder.CreateBitCast(builder.CreateTrunc(raw, builder.getInt32Ty()), builder.getFloatTy());
+            }
+            else if (float_values)
+            {
+                value = builder.CreateFPTrunc(emit_raw_to_phys(builder, raw, sig), builder.getFloatTy());
+            }
+            else
+            {
+                value = emit_raw_to_phys(builder, raw, sig);
+            }
+            builder.CreateStore(value, builder.CreateConstInBoundsGEP1_64(value_type, values, sig.getIndex()));
+        };
+        std::map<uint64_t, std::vector<const SignalImpl*>> muxed;
+        for (const auto& sig : msg.signalsByIndex())
+        {
+            if (sig.getMultiplexerIndicator() == Signal::Multiplexer::MuxValue)
+            {
+                muxed[sig.getMultiplexerSwitchValue()].push_back(&sig);
+            }
+            else
+            {
+                store(sig);
+            }
+        }
+        const auto* mux_sig = static_cast<const SignalImpl*>(msg.getMuxSignal());
+        if (mux_sig && !muxed.empty())
+        {
+            auto* done = llvm::BasicBlock::Create(ctx, "done", fn);
+            auto* sw = builder.CreateSwitch(emit_decode(builder, data, *mux_sig), done, unsigned(muxed.size()));
+            for (const auto& branch : muxed)
+            {
+                auto* bb = llvm::BasicBlock::Create(ctx, "mux_" + std::to_string(branch.first), fn, done);
+                sw->addCase(builder.getInt64(branch.first), bb);
+                builder.SetInsertPoint(bb);
+                for (const SignalImpl* sig : branch.second)
+                {
+                    store(*sig);
+                }
+                builder.CreateBr(done);
+            }
+            builder.SetInsertPoint(done);
+        }
+        builder.CreateRetVoid();
+    }
+    void optimize(llvm::Module& module)
+    {
+        llvm::LoopAnalysisManager lam;
+        llvm::FunctionAnalysisManager fam;
+        llvm::CGSCCAnalysisManager cgam;
+        llvm::ModuleAnalysisManager mam;
+        llvm::PassBuilder pb;
+        pb.registerModuleAnalyses(mam);
+        pb.registerCGSCCAnalyses(cgam);
+        pb.registerFunctionAnalyses(fam);
+        pb.registerLoopAnalyses(lam);
+        pb.crossRegisterProxies(lam, fam, cgam, mam);
+        pb.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O2).run(module, mam);
+    }
+}
+
+bool Network::jitCompile()
+{
+    static std::once_flag init;
+    std::call_once(init,
+        []
+        {
+            llvm::InitializeNativeTarget();
+            llvm::InitializeNativeTargetAsmPrinter();
+        });
+    auto lljit = llvm::orc::LLJITBuilder().create();
+    if (!lljit)
+    {
+        llvm::consumeError(lljit.takeError());
+        return false;
+    }
+    auto ctx = std::make_unique<llvm::LLVMContext>();
+    auto module = std::make_unique<llvm::Module>("dbcppp", *ctx);
+    module->setDataLayout((*lljit)->getDataLayout());
+
+    auto& self = static_cast<NetworkImpl&>(*this);
+    std::vector<std::pair<MessageImpl*, std::string>> functions;
+    for (auto iter = self.messagesById().begin(); iter != self.messagesById().end(); ++iter)
+    {
+        MessageImpl& msg = iter.value();
+        if (msg.getError() != Message::ErrorCode::NoError)
+        {
+            continue;
+        }
+        functions.emplace_back(&msg, "decode_all_" + std::to_string(functions.size()));
+        emit_decode_all(*module, functions.back().second, msg, false);
+        emit_decode_all(*module, functions.back().second + "_float", msg, true);
+    }
+    if (llvm::verifyModule(*module))
+    {
+        return false;
+    }
+    optimize(*module);
+    if (auto err = (*lljit)->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), std::move(ctx))))
+    {
+        llvm::consumeError(std::move(err));
+        return false;
+    }
+    std::shared_ptr<llvm::orc::LLJIT> jit = std::move(*lljit);
+    for (const auto& f : functions)
+    {
+        auto sym = jit->lookup(f.second);
+        if (!sym)
+        {
+            llvm::consumeError(sym.takeError());
+            return false;
+        }
+        auto sym_float = jit->lookup(f.second + "_float");
+        if (!sym_float)
+        {
+            llvm::consumeError(sym_float.takeError());
+            return false;
+        }
+#if LLVM_VERSION_MAJOR >= 15
+        f.first->setJitDecodeAll(sym->toPtr<MessageImpl::decode_all_t>(),
+            sym_float->toPtr<MessageImpl::decode_all_float_t>(), jit);
+#else
+        f.first->setJitDecodeAll(reinterpret_cast<MessageImpl::decode_all_t>(sym->getAddress()),
+            reinterpret_cast<MessageImpl::decode_all_float_t>(sym_float->getAddress()), jit);
+#endif
+    }
+    return true;
+}
+
+#else
+
+bool dbcppp::Network::jitCompile()
+{
+    return false;
+}
+
+#endif
@@ -35,22 +35,16 @@ const std::string& NodeImpl::getComment() const
 }
 const Attribute* NodeImpl::getAttributeValueByName(const std::string& name) const
 {
-    const Attribute* result = nullptr;
-    auto iter = _attribute_values.find(name);
-    if (iter != _attribute_values.end())
-    {
-        result = &iter->second;
-    }
-    return result;
+    return _attribute_values.find(name);
 }
 const Attribute* NodeImpl::findAttributeValue(std::function<bool(const Attribute&)>&& pred) const
 {
     const Attribute* result = nullptr;
     for (auto& av : _attribute_values)
     {
-        if (pred(av.second))
+        if (pred(av))
         {
-            result = &av.second;
+            result = &av;
             break;
         }
     }
@@ -60,6 +54,6 @@ void NodeImpl::forEachAttributeValue(std::function<void(const Attribute&)>&& cb)
 {
     for (const auto& av : _attribute_values)
     {
-        cb(av.second);
+        cb(av);
     }
 }
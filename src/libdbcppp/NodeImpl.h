@@ -28,7 +28,7 @@ namespace dbcppp
 
         std::string _name;
         std::string _comment;
-        std::map<std::string, AttributeImpl> _attribute_values;
+        SortedByName<AttributeImpl> _attribute_values;
     };
     bool operator==(const dbcppp::NodeImpl& lhs, const std::string& rhs);
 }
@@ -0,0 +1,243 @@
+
+#include <type_traits>
+#include "ParallelDecoderImpl.h"
+
+using namespace dbcppp;
+
+// more shards than workers, so the workers can balance the load by stealing
+static constexpr std::size_t shards_per_worker = 8;
+
+std::unique_ptr<ParallelDecoder> ParallelDecoder::create(std::vector<const Network*> networks, std::size_t n_threads)
+{
+    if (n_threads == 0)
+    {
+        n_threads = std::thread::hardware_concurrency();
+    }
+    if (n_threads == 0)
+    {
+        n_threads = 1;
+    }
+    return std::make_unique<ParallelDecoderImpl>(std::move(networks), n_threads);
+}
+
+ParallelDecoderImpl::ParallelDecoderImpl(std::vector<const Network*>&& networks, std::size_t n_threads)
+    : _plans(networks.size())
+    , _shards(n_threads * shards_per_worker)
+    , _frames(nullptr)
+    , _float_values(false)
+    , _generation(0)
+    , _busy_workers(0)
+    , _stop(false)
+{
+    for (std::size_t bus = 0; bus < networks.size(); bus++)
+    {
+        if (!networks[bus])
+        {
+            continue;
+        }
+        networks[bus]->forEachMessage(
+            [&](const Message& msg)
+            {
+                MessagePlan plan;
+                plan.message = &msg;
+                plan.mux_signal = msg.getMuxSignal();
+                msg.forEachSignal(
+                    [&](const Signal& sig)
+                    {
+                        plan.signals.push_back(&sig);
+                    });
+                _plans[bus].insert(std::make_pair(msg.getId(), std::move(plan)));
+            });
+    }
+    for (std::size_t i = 0; i < n_threads; i++)
+    {
+        _workers.push_back(std::make_unique<Worker>());
+    }
+    for (std::size_t i = 0; i < n_threads; i++)
+    {
+        _workers[i]->thread = std::thread(&ParallelDecoderImpl::run, this, i);
+    }
+}
+ParallelDecoderImpl::~ParallelDecoderImpl()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv_start.notify_all();
+    for (auto& worker : _workers)
+    {
+        worker->thread.join();
+    }
+}
+std::size_t ParallelDecoderImpl::getThreadCount() const
+{
+    return _workers.size();
+}
+template <>
+std::vector<ParallelDecoder::Value>& ParallelDecoderImpl::values<ParallelDecoder::Value>(Worker& worker)
+{
+    return worker.values;
+}
+template <>
+std::vector<ParallelDecoder::FloatValue>& ParallelDecoderImpl::values<ParallelDecoder::FloatValue>(Worker& worker)
+{
+    return worker.float_values;
+}
+void ParallelDecoderImpl::decode(const Frame* frames, std::size_t n, const callback_t& cb)
+{
+    decodeBatch<Value>(frames, n, cb);
+}
+void ParallelDecoderImpl::decodeFloat(const Frame* frames, std::size_t n, const float_callback_t& cb)
+{
+    decodeBatch<FloatValue>(frames, n, cb);
+}
+template <class V>
+void ParallelDecoderImpl::decodeBatch(const Frame* frames, std::size_t n, const std::function<void(const V*, std::size_t)>& cb)
+{
+    if (n == 0)
+    {
+        return;
+    }
+    for (auto& shard : _shards)
+    {
+        shard.clear();
+    }
+    for (std::size_t i = 0; i < n; i++)
+    {
+        uint64_t key = (uint64_t(frames[i].bus) << 32) ^ frames[i].id;
+        std::size_t shard = std::size_t((key * 0x9E3779B97F4A7C15ull) >> 32) % _shards.size();
+        _shards[shard].push_back(i);
+    }
+    for (std::size_t i = 0; i < _workers.size(); i++)
+    {
+        auto& worker = *_workers[i];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        values<V>(worker).clear();
+        for (std::size_t shard = i; shard < _shards.size(); shard += _workers.size())
+        {
+            if (!_shards[shard].empty())
+            {
+                worker.shards.push_back(shard);
+            }
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _frames = frames;
+        _float_values = std::is_same<V, FloatValue>::value;
+        _busy_workers = _workers.size();
+        _generation++;
+    }
+    _cv_start.notify_all();
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv_done.wait(lock, [&] { return _busy_workers == 0; });
+    }
+    for (const auto& worker : _workers)
+    {
+        const auto& vs = values<V>(*worker);
+        if (!vs.empty())
+        {
+            cb(&vs[0], vs.size());
+        }
+    }
+}
+void ParallelDecoderImpl::run(std::size_t worker)
+{
+    uint64_t generation = 0;
+    while (true)
+    {
+        bool float_values;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv_start.wait(lock, [&] { return _stop || _generation != generation; });
+            if (_stop)
+            {
+                return;
+            }
+            generation = _generation;
+            float_values = _float_values;
+        }
+        std::size_t shard;
+        while (popShard(worker, shard))
+        {
+            if (float_values)
+            {
+                decodeShard(shard, _workers[worker]->float_values);
+            }
+            else
+            {
+                decodeShard(shard, _workers[worker]->values);
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _busy_workers--;
+        }
+        _cv_done.notify_one();
+    }
+}
+bool ParallelDecoderImpl::popShard(std::size_t worker, std::size_t& shard)
+{
+    {
+        auto& own = *_workers[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.shards.empty())
+        {
+            shard = own.shards.front();
+            own.shards.pop_front();
+            return true;
+        }
+    }
+    // steal from the back, the owner takes from the front
+    for (std::size_t i = 1; i < _workers.size(); i++)
+    {
+        auto& victim = *_workers[(worker + i) % _workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.shards.empty())
+        {
+            shard = victim.shards.back();
+            victim.shards.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+static ParallelDecoder::Value make_value(const Frame& frame, const Message* msg, const Signal* sig, Signal::raw_t raw, ParallelDecoder::Value*)
+{
+    return ParallelDecoder::Value{frame.timestamp, frame.bus, msg, sig, raw, sig->rawToPhys(raw)};
+}
+static ParallelDecoder::FloatValue make_value(const Frame& frame, const Message* msg, const Signal* sig, Signal::raw_t raw, ParallelDecoder::FloatValue*)
+{
+    return ParallelDecoder::FloatValue{frame.timestamp, msg, sig, raw, frame.bus, sig->rawToPhysFloat(raw)};
+}
+template <class V>
+void ParallelDecoderImpl::decodeShard(std::size_t shard, std::vector<V>& values) const
+{
+    for (std::size_t i : _shards[shard])
+    {
+        const Frame& frame = _frames[i];
+        if (frame.bus >= _plans.size())
+        {
+            continue;
+        }
+        auto iter = _plans[frame.bus].find(frame.id);
+        if (iter == _plans[frame.bus].end())
+        {
+            continue;
+        }
+        const MessagePlan& plan = iter->second;
+        uint64_t mux_value = plan.mux_signal ? plan.mux_signal->decode(frame.data) : 0;
+        for (const Signal* sig : plan.signals)
+        {
+            if (sig->getMultiplexerIndicator() == Signal::Multiplexer::MuxValue &&
+                (!plan.mux_signal || sig->getMultiplexerSwitchValue() != mux_value))
+            {
+                continue;
+            }
+            Signal::raw_t raw = sig->decode(frame.data);
+            values.push_back(make_value(frame, plan.message, sig, raw, static_cast<V*>(nullptr)));
+        }
+    }
+}
@@ -0,0 +1,69 @@
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <robin-map/tsl/robin_map.h>
+
+#include "../../include/dbcppp/ParallelDecoder.h"
+
+namespace dbcppp
+{
+    class ParallelDecoderImpl final
+        : public ParallelDecoder
+    {
+    public:
+        ParallelDecoderImpl(std::vector<const Network*>&& networks, std::size_t n_threads);
+        ParallelDecoderImpl(const ParallelDecoderImpl&) = delete;
+        ParallelDecoderImpl& operator=(const ParallelDecoderImpl&) = delete;
+        virtual ~ParallelDecoderImpl();
+
+        virtual std::size_t getThreadCount() const override;
+        virtual void decode(const Frame* frames, std::size_t n, const callback_t& cb) override;
+        virtual void decodeFloat(const Frame* frames, std::size_t n, const float_callback_t& cb) override;
+
+    private:
+        // everything needed to decode a message, prepared once so the workers don't have to go through the std::function based API
+        struct MessagePlan
+        {
+            const Message* message;
+            const Signal* mux_signal;
+            std::vector<const Signal*> signals;
+        };
+        struct Worker
+        {
+            std::mutex mutex;
+            // indices of the shards which are assigned to this worker
+            std::deque<std::size_t> shards;
+            std::vector<Value> values;
+            std::vector<FloatValue> float_values;
+            std::thread thread;
+        };
+
+        template <class V>
+        static std::vector<V>& values(Worker& worker);
+        template <class V>
+        void decodeBatch(const Frame* frames, std::size_t n, const std::function<void(const V*, std::size_t)>& cb);
+        void run(std::size_t worker);
+        bool popShard(std::size_t worker, std::size_t& shard);
+        template <class V>
+        void decodeShard(std::size_t shard, std::vector<V>& values) const;
+
+        std::vector<tsl::robin_map<uint64_t, MessagePlan>> _plans;
+        std::vector<std::unique_ptr<Worker>> _workers;
+        // indices of the frames of the current batch per shard
+        std::vector<std::vector<std::size_t>> _shards;
+        const Frame* _frames;
+        // the current batch is decoded into Worker::float_values
+        bool _float_values;
+
+        std::mutex _mutex;
+        std::condition_variable _cv_start;
+        std::condition_variable _cv_done;
+        uint64_t _generation;
+        std::size_t _busy_workers;
+        bool _stop;
+    };
+}
@@ -0,0 +1,120 @@
+
+#include <map>
+#include <algorithm>
+#include <iostream>
+#include "ProjectionPlanImpl.h"
+
+using namespace dbcppp;
+
+std::unique_ptr<ProjectionPlan> ProjectionPlan::create(const Network& network, std::vector<const Signal*> signals)
+{
+    for (const Signal* sig : signals)
+    {
+        if (sig && !network.findParentMessage(sig))
+        {
+            std::cout << "Error! Signal \"" << sig->getName() << "\" isn't part of the network" << std::endl;
+            return nullptr;
+        }
+    }
+    return std::make_unique<ProjectionPlanImpl>(network, std::move(signals));
+}
+
+ProjectionPlanImpl::ProjectionPlanImpl(const Network& network, std::vector<const Signal*>&& signals)
+    : _signals(std::move(signals))
+{
+    // group the signals by message, in the order of the message's signals
+    std::map<const Message*, std::vector<Entry>> by_message;
+    for (std::size_t i = 0; i < _signals.size(); i++)
+    {
+        const Signal* sig = _signals[i];
+        if (!sig)
+        {
+            continue;
+        }
+        bool multiplexed = sig->getMultiplexerIndicator() == Signal::Multiplexer::MuxValue;
+        by_message[network.findParentMessage(sig)].push_back(
+            Entry{sig, i, multiplexed, sig->getMultiplexerSwitchValue()});
+    }
+    for (auto& msg_entries : by_message)
+    {
+        const Message* msg = msg_entries.first;
+        auto& entries = msg_entries.second;
+        std::stable_sort(entries.begin(), entries.end(),
+            [](const Entry& lhs, const Entry& rhs)
+            {
+                return lhs.signal->getIndex() < rhs.signal->getIndex();
+            });
+        MessagePlan plan{nullptr, _entries.size(), _entries.size()};
+        for (const auto& entry : entries)
+        {
+            if (entry.multiplexed)
+            {
+                plan.mux_signal = msg->getMuxSignal();
+            }
+            _entries.push_back(entry);
+        }
+        plan.end = _entries.size();
+        _messages.insert(std::make_pair(msg->getId(), plan));
+    }
+}
+std::size_t ProjectionPlanImpl::size() const
+{
+    return _signals.size();
+}
+const Signal* ProjectionPlanImpl::getSignal(std::size_t index) const
+{
+    return index < _signals.size() ? _signals[index] : nullptr;
+}
+bool ProjectionPlanImpl::hasMessage(uint64_t message_id) const
+{
+    return _messages.find(message_id) != _messages.end();
+}
+static void store(double* values, std::size_t output, const Signal* sig, Signal::raw_t raw)
+{
+    values[output] = sig->rawToPhys(raw);
+}
+static void store(float* values, std::size_t output, const Signal* sig, Signal::raw_t raw)
+{
+    values[output] = sig->rawToPhysFloat(raw);
+}
+template <class T>
+std::size_t ProjectionPlanImpl::decodeMessage(const MessagePlan& plan, const void* bytes, T* values) const
+{
+    uint64_t mux_value = plan.mux_signal ? plan.mux_signal->decode(bytes) : 0;
+    std::size_t n = 0;
+    for (std::size_t i = plan.begin; i < plan.end; i++)
+    {
+        const Entry& entry = _entries[i];
+        // without mux signal a multiplexed signal is never active
+        if (entry.multiplexed && (!plan.mux_signal || entry.switch_value != mux_value))
+        {
+            continue;
+        }
+        store(values, entry.output, entry.signal, entry.signal->decode(bytes));
+        n++;
+    }
+    return n;
+}
+std::size_t ProjectionPlanImpl::decode(uint64_t message_id, const void* bytes, double* values) const
+{
+    auto iter = _messages.find(message_id);
+    return iter == _messages.end() ? 0 : decodeMessage(iter->second, bytes, values);
+}
+std::size_t ProjectionPlanImpl::decode(uint64_t message_id, const void* bytes, float* values) const
+{
+    auto iter = _messages.find(message_id);
+    return iter == _messages.end() ? 0 : decodeMessage(iter->second, bytes, values);
+}
+std::size_t ProjectionPlanImpl::decode(const Frame* frames, std::size_t n, double* values) const
+{
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        auto iter = _messages.find(frames[i].id);
+        if (iter != _messages.end())
+        {
+            result += decodeMessage(iter->second, frames[i].data, values);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,48 @@
+
+#pragma once
+
+#include <robin-map/tsl/robin_map.h>
+
+#include "../../include/dbcppp/ProjectionPlan.h"
+
+namespace dbcppp
+{
+    class ProjectionPlanImpl final
+        : public ProjectionPlan
+    {
+    public:
+        ProjectionPlanImpl(const Network& network, std::vector<const Signal*>&& signals);
+
+        virtual std::size_t size() const override;
+        virtual const Signal* getSignal(std::size_t index) const override;
+        virtual bool hasMessage(uint64_t message_id) const override;
+        virtual std::size_t decode(uint64_t message_id, const void* bytes, double* values) const override;
+        virtual std::size_t decode(uint64_t message_id, const void* bytes, float* values) const override;
+        virtual std::size_t decode(const Frame* frames, std::size_t n, double* values) const override;
+
+    private:
+        struct Entry
+        {
+            const Signal* signal;
+            std::size_t output;
+            bool multiplexed;
+            uint64_t switch_value;
+        };
+        struct MessagePlan
+        {
+            // nullptr if none of the entries is multiplexed, then the switch isn't decoded at all
+            const Signal* mux_signal;
+            // range in _entries
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        template <class T>
+        std::size_t decodeMessage(const MessagePlan& plan, const void* bytes, T* values) const;
+
+        std::vector<const Signal*> _signals;
+        // the entries of one message are adjacent
+        std::vector<Entry> _entries;
+        tsl::robin_map<uint64_t, MessagePlan> _messages;
+    };
+}
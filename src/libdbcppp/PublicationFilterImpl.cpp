@@ -0,0 +1,106 @@
+
+#include <cmath>
+#include <algorithm>
+#include "PublicationFilterImpl.h"
+
+using namespace dbcppp;
+
+std::unique_ptr<PublicationFilter> PublicationFilter::create(const Network& network)
+{
+    return std::make_unique<PublicationFilterImpl>(network);
+}
+
+PublicationFilterImpl::PublicationFilterImpl(const Network& network)
+    : _rules(network.signalCount())
+    , _states(network.signalCount(), State{0, 0, 0., false})
+{
+}
+void PublicationFilterImpl::setRule(const Signal& sig, const Rule& rule)
+{
+    if (sig.getGlobalIndex() < _rules.size())
+    {
+        _rules[sig.getGlobalIndex()] = rule;
+    }
+}
+void PublicationFilterImpl::setRule(const Rule& rule)
+{
+    std::fill(_rules.begin(), _rules.end(), rule);
+}
+const PublicationFilter::Rule& PublicationFilterImpl::getRule(const Signal& sig) const
+{
+    return sig.getGlobalIndex() < _rules.size() ? _rules[sig.getGlobalIndex()] : _default_rule;
+}
+bool PublicationFilterImpl::publish(std::size_t index, uint64_t timestamp, Signal::raw_t raw, double phys)
+{
+    if (index >= _states.size())
+    {
+        return true;
+    }
+    const Rule& rule = _rules[index];
+    State& state = _states[index];
+    if (state.published)
+    {
+        if (timestamp - state.timestamp < rule.min_interval)
+        {
+            return false;
+        }
+        if (rule.on_change)
+        {
+            if (raw == state.raw)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            double deadband = std::max(rule.absolute_deadband, rule.relative_deadband * std::abs(state.phys));
+            if (deadband > 0.)
+            {
+                // NaN has no distance to anything, any change of the raw value counts
+                if (std::isnan(phys) || std::isnan(state.phys) ? raw == state.raw : std::abs(phys - state.phys) < deadband)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    state.timestamp = timestamp;
+    state.raw = raw;
+    state.phys = phys;
+    state.published = true;
+    return true;
+}
+bool PublicationFilterImpl::publish(const Signal& sig, uint64_t timestamp, Signal::raw_t raw, double phys)
+{
+    return publish(sig.getGlobalIndex(), timestamp, raw, phys);
+}
+template <class V>
+std::size_t PublicationFilterImpl::filterValues(V* values, std::size_t n)
+{
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        const V& value = values[i];
+        if (publish(value.signal->getGlobalIndex(), value.timestamp, value.raw, double(value.phys)))
+        {
+            values[result++] = value;
+        }
+    }
+    return result;
+}
+std::size_t PublicationFilterImpl::filter(MessageDecoder::Value* values, std::size_t n)
+{
+    return filterValues(values, n);
+}
+std::size_t PublicationFilterImpl::filter(ParallelDecoder::Value* values, std::size_t n)
+{
+    return filterValues(values, n);
+}
+std::size_t PublicationFilterImpl::filter(ParallelDecoder::FloatValue* values, std::size_t n)
+{
+    return filterValues(values, n);
+}
+void PublicationFilterImpl::reset()
+{
+    std::fill(_states.begin(), _states.end(), State{0, 0, 0., false});
+}
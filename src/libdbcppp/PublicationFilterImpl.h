@@ -0,0 +1,44 @@
+
+#pragma once
+
+#include <vector>
+
+#include "../../include/dbcppp/PublicationFilter.h"
+
+namespace dbcppp
+{
+    class PublicationFilterImpl final
+        : public PublicationFilter
+    {
+    public:
+        PublicationFilterImpl(const Network& network);
+
+        virtual void setRule(const Signal& sig, const Rule& rule) override;
+        virtual void setRule(const Rule& rule) override;
+        virtual const Rule& getRule(const Signal& sig) const override;
+        virtual bool publish(const Signal& sig, uint64_t timestamp, Signal::raw_t raw, double phys) override;
+        virtual std::size_t filter(MessageDecoder::Value* values, std::size_t n) override;
+        virtual std::size_t filter(ParallelDecoder::Value* values, std::size_t n) override;
+        virtual std::size_t filter(ParallelDecoder::FloatValue* values, std::size_t n) override;
+        virtual void reset() override;
+
+    private:
+        // the last published value
+        struct State
+        {
+            uint64_t timestamp;
+            Signal::raw_t raw;
+            double phys;
+            bool published;
+        };
+
+        bool publish(std::size_t index, uint64_t timestamp, Signal::raw_t raw, double phys);
+        template <class V>
+        std::size_t filterValues(V* values, std::size_t n);
+
+        std::vector<Rule> _rules;
+        std::vector<State> _states;
+        // for signals which aren't part of the network
+        Rule _default_rule;
+    };
+}
@@ -0,0 +1,200 @@
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "../../include/dbcppp/RawPredicate.h"
+
+using namespace dbcppp;
+
+namespace
+{
+    // the raw values of a signal in ascending order are the ordinals [0, max], raw = ordinal - bias
+    struct Domain
+    {
+        uint64_t bias;
+        uint64_t max;
+
+        Domain(const Signal& sig)
+        {
+            uint64_t bit_size = std::min<uint64_t>(std::max<uint64_t>(sig.getBitSize(), 1), 64);
+            max = bit_size == 64 ? ~uint64_t(0) : (uint64_t(1) << bit_size) - 1;
+            bias = sig.getValueType() == Signal::ValueType::Signed ? uint64_t(1) << (bit_size - 1) : 0;
+        }
+        uint64_t raw(uint64_t ordinal) const
+        {
+            return ordinal - bias;
+        }
+    };
+    // the first ordinal for which pred is true, pred has to be false up to some ordinal and true from there on
+    template <class Pred>
+    bool first_true(const Domain& domain, Pred&& pred, uint64_t& result)
+    {
+        if (!pred(domain.raw(domain.max)))
+        {
+            return false;
+        }
+        uint64_t lo = 0;
+        uint64_t hi = domain.max;
+        while (lo < hi)
+        {
+            uint64_t mid = lo + (hi - lo) / 2;
+            if (pred(domain.raw(mid)))
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+        result = lo;
+        return true;
+    }
+    // the ordinals [lo, hi] for which pred is true, pred has to be monotone, false if there are none
+    template <class Pred>
+    bool monotone_range(const Domain& domain, bool ascending, Pred&& pred, uint64_t& lo, uint64_t& hi)
+    {
+        uint64_t first;
+        if (ascending)
+        {
+            lo = 0;
+            hi = domain.max;
+            if (!first_true(domain, pred, first))
+            {
+                return false;
+            }
+            lo = first;
+            return true;
+        }
+        lo = 0;
+        hi = domain.max;
+        if (first_true(domain, [&](uint64_t raw) { return !pred(raw); }, first))
+        {
+            if (first == 0)
+            {
+                return false;
+            }
+            hi = first - 1;
+        }
+        return true;
+    }
+}
+
+RawPredicate::RawPredicate(const Signal& sig)
+    : _signal(&sig)
+    , _kind(Kind::Range)
+    , _negate(false)
+    , _base(0)
+    , _span(~uint64_t(0))
+    , _lower(0.)
+    , _upper(0.)
+    , _lower_inclusive(true)
+    , _upper_inclusive(true)
+{
+}
+RawPredicate RawPredicate::fromBounds(const Signal& sig, double lower, bool lower_inclusive, double upper, bool upper_inclusive)
+{
+    RawPredicate result(sig);
+    result._lower = lower;
+    result._upper = upper;
+    result._lower_inclusive = lower_inclusive;
+    result._upper_inclusive = upper_inclusive;
+    if (sig.getExtendedValueType() != Signal::ExtendedValueType::Integer)
+    {
+        result._kind = Kind::Phys;
+        return result;
+    }
+    // rawToPhys is monotone in the raw value, ascending for a positive factor and descending for a negative one,
+    // so each bound holds for a prefix or a suffix of the raw values and both together for a range of them
+    Domain domain(sig);
+    bool ascending = !(sig.getFactor() < 0.);
+    auto above_lower = [&](uint64_t raw)
+    {
+        double phys = sig.rawToPhys(raw);
+        return lower_inclusive ? phys >= lower : phys > lower;
+    };
+    auto below_upper = [&](uint64_t raw)
+    {
+        double phys = sig.rawToPhys(raw);
+        return upper_inclusive ? phys <= upper : phys < upper;
+    };
+    uint64_t lo0, hi0, lo1, hi1;
+    if (!monotone_range(domain, ascending, above_lower, lo0, hi0) ||
+        !monotone_range(domain, !ascending, below_upper, lo1, hi1) ||
+        std::max(lo0, lo1) > std::min(hi0, hi1))
+    {
+        // never true: the negation of always
+        result._negate = true;
+        return result;
+    }
+    uint64_t lo = std::max(lo0, lo1);
+    uint64_t hi = std::min(hi0, hi1);
+    result._base = domain.raw(lo);
+    result._span = hi - lo;
+    return result;
+}
+RawPredicate RawPredicate::create(const Signal& sig, Op op, double value)
+{
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    switch (op)
+    {
+    case Op::Less: return fromBounds(sig, -inf, true, value, false);
+    case Op::LessEqual: return fromBounds(sig, -inf, true, value, true);
+    case Op::Greater: return fromBounds(sig, value, false, inf, true);
+    case Op::GreaterEqual: return fromBounds(sig, value, true, inf, true);
+    case Op::Equal: return fromBounds(sig, value, true, value, true);
+    case Op::NotEqual: return !fromBounds(sig, value, true, value, true);
+    }
+    return fromBounds(sig, value, true, value, true);
+}
+RawPredicate RawPredicate::inRange(const Signal& sig, double lower, double upper)
+{
+    return fromBounds(sig, lower, true, upper, true);
+}
+RawPredicate RawPredicate::hasLabel(const Signal& sig, const std::string& label)
+{
+    RawPredicate result(sig);
+    result._kind = Kind::Set;
+    sig.forEachValueDescription(
+        [&](int64_t value, const std::string& desc)
+        {
+            if (desc == label)
+            {
+                result._set.push_back(uint64_t(value));
+            }
+        });
+    std::sort(result._set.begin(), result._set.end());
+    // one value, or adjacent values, are a range
+    if (!result._set.empty() && result._set.back() - result._set.front() == result._set.size() - 1)
+    {
+        result._kind = Kind::Range;
+        result._base = result._set.front();
+        result._span = result._set.size() - 1;
+        result._set.clear();
+    }
+    return result;
+}
+RawPredicate RawPredicate::operator!() const
+{
+    RawPredicate result(*this);
+    result._negate = !_negate;
+    return result;
+}
+const Signal& RawPredicate::getSignal() const
+{
+    return *_signal;
+}
+bool RawPredicate::isRawDomain() const
+{
+    return _kind != Kind::Phys;
+}
+bool RawPredicate::contains(Signal::raw_t raw) const noexcept
+{
+    return std::binary_search(_set.begin(), _set.end(), raw);
+}
+bool RawPredicate::testPhys(Signal::raw_t raw) const noexcept
+{
+    double phys = _signal->rawToPhys(raw);
+    return (_lower_inclusive ? phys >= _lower : phys > _lower) &&
+        (_upper_inclusive ? phys <= _upper : phys < _upper);
+}
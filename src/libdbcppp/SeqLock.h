@@ -0,0 +1,101 @@
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <cstring>
+#include <cstdint>
+
+#include "../../include/dbcppp/SignalStateStore.h"
+
+namespace dbcppp
+{
+    // a signal value guarded by a seqlock, the members are only accessed atomically,
+    // so torn reads are detected by the sequence instead of being data races
+    struct SeqLockValue
+    {
+        std::atomic<uint64_t> timestamp;
+        std::atomic<uint64_t> raw;
+        std::atomic<uint64_t> phys;
+        std::atomic<uint64_t> update;
+    };
+    // the values may live in memory shared between processes
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "the seqlock needs lock free 64 bit atomics");
+    static_assert(sizeof(SeqLockValue) == 32, "SeqLockValue must not have padding");
+
+    // locks the sequence against other writers, returns the number of the update, which starts with 1
+    inline uint64_t seqlock_write_begin(std::atomic<uint64_t>& sequence, uint64_t& seq) noexcept
+    {
+        seq = sequence.load(std::memory_order_relaxed);
+        do
+        {
+            while (seq & 1)
+            {
+                std::this_thread::yield();
+                seq = sequence.load(std::memory_order_relaxed);
+            }
+        } while (!sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed));
+        // the odd sequence has to be visible before any of the values
+        std::atomic_thread_fence(std::memory_order_release);
+        return seq / 2 + 1;
+    }
+    inline void seqlock_write_end(std::atomic<uint64_t>& sequence, uint64_t seq) noexcept
+    {
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+    // calls copy until it ran without a writer in between, returns the number of updates so far
+    template <class F>
+    uint64_t seqlock_read(const std::atomic<uint64_t>& sequence, F&& copy)
+    {
+        while (true)
+        {
+            uint64_t before = sequence.load(std::memory_order_acquire);
+            if (before & 1)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            copy();
+            // the values have to be read before the sequence is checked again
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before)
+            {
+                return before / 2;
+            }
+        }
+    }
+    inline void seqlock_store(SeqLockValue& value, uint64_t timestamp, uint64_t raw, double phys, uint64_t update) noexcept
+    {
+        uint64_t phys_bits;
+        std::memcpy(&phys_bits, &phys, sizeof(phys_bits));
+        value.timestamp.store(timestamp, std::memory_order_relaxed);
+        value.raw.store(raw, std::memory_order_relaxed);
+        value.phys.store(phys_bits, std::memory_order_relaxed);
+        value.update.store(update, std::memory_order_relaxed);
+    }
+    inline void seqlock_load(const SeqLockValue& stored, SignalStateStore::Value& value) noexcept
+    {
+        uint64_t phys_bits = stored.phys.load(std::memory_order_relaxed);
+        value.timestamp = stored.timestamp.load(std::memory_order_relaxed);
+        value.raw = stored.raw.load(std::memory_order_relaxed);
+        std::memcpy(&value.phys, &phys_bits, sizeof(value.phys));
+        value.update = stored.update.load(std::memory_order_relaxed);
+    }
+    // decodes the active signals of msg into values[Signal::getIndex]
+    inline void seqlock_store_message(const Message& msg, const void* bytes, uint64_t timestamp, SeqLockValue* values, uint64_t update) noexcept
+    {
+        const Signal* mux_sig = msg.getMuxSignal();
+        uint64_t mux_value = mux_sig ? mux_sig->decode(bytes) : 0;
+        for (std::size_t i = 0; i < msg.signalCount(); i++)
+        {
+            const Signal& sig = *msg.getSignalByIndex(i);
+            if (sig.getMultiplexerIndicator() == Signal::Multiplexer::MuxValue &&
+                (!mux_sig || sig.getMultiplexerSwitchValue() != mux_value))
+            {
+                continue;
+            }
+            Signal::raw_t raw = sig.decode(bytes);
+            seqlock_store(values[i], timestamp, raw, sig.rawToPhys(raw), update);
+        }
+    }
+}
@@ -0,0 +1,435 @@
+
+#include <new>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include "SharedSignalTableImpl.h"
+
+using namespace dbcppp;
+using namespace dbcppp::shared_layout;
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace
+{
+    struct Layout
+    {
+        uint64_t n_messages;
+        uint64_t n_signals;
+        uint64_t messages_offset;
+        uint64_t signals_offset;
+        uint64_t values_offset;
+        uint64_t names_offset;
+        uint64_t size;
+    };
+    uint64_t align64(uint64_t n)
+    {
+        return (n + 63) & ~uint64_t(63);
+    }
+    Layout layout(const Network& network)
+    {
+        Layout result;
+        result.n_messages = 0;
+        result.n_signals = network.signalCount();
+        uint64_t names_size = 0;
+        network.forEachMessage(
+            [&](const Message& msg)
+            {
+                result.n_messages++;
+                names_size += msg.getName().size() + 1;
+                for (const Signal& sig : msg.signals())
+                {
+                    names_size += sig.getName().size() + 1;
+                }
+            });
+        result.messages_offset = sizeof(Header);
+        result.signals_offset = result.messages_offset + result.n_messages * sizeof(MessageEntry);
+        result.values_offset = align64(result.signals_offset + result.n_signals * sizeof(SignalEntry));
+        result.names_offset = result.values_offset + result.n_signals * sizeof(SeqLockValue);
+        result.size = result.names_offset + names_size;
+        return result;
+    }
+    // FNV-1a
+    class LayoutHash
+    {
+    public:
+        void add(const void* data, std::size_t n)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            for (std::size_t i = 0; i < n; i++)
+            {
+                _hash = (_hash ^ bytes[i]) * 0x100000001B3ull;
+            }
+        }
+        void add(uint64_t value)
+        {
+            add(&value, sizeof(value));
+        }
+        void add(double value)
+        {
+            add(&value, sizeof(value));
+        }
+        void add(const std::string& value)
+        {
+            add(value.c_str(), value.size() + 1);
+        }
+        uint64_t get() const
+        {
+            return _hash;
+        }
+
+    private:
+        uint64_t _hash = 0xCBF29CE484222325ull;
+    };
+}
+
+std::unique_ptr<SharedSignalTable> SharedSignalTable::create(const std::string& name, const Network& network)
+{
+    std::size_t size = SharedSignalTableImpl::layoutSize(network);
+    // a new segment instead of truncating the old one, the readers of the old one would crash on access
+    shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0)
+    {
+        std::cout << "Error! Couldn't create shared memory \"" << name << "\": " << std::strerror(errno) << std::endl;
+        return nullptr;
+    }
+    if (ftruncate(fd, off_t(size)) < 0)
+    {
+        std::cout << "Error! Couldn't resize shared memory \"" << name << "\": " << std::strerror(errno) << std::endl;
+        close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        std::cout << "Error! Couldn't map shared memory \"" << name << "\": " << std::strerror(errno) << std::endl;
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    SharedSignalTableImpl::initialize(memory, network);
+    return std::make_unique<SharedSignalTableImpl>(std::string(name), memory, size, &network);
+}
+std::unique_ptr<SharedSignalTable> SharedSignalTable::open(const std::string& name)
+{
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+    {
+        std::cout << "Error! Couldn't open shared memory \"" << name << "\": " << std::strerror(errno) << std::endl;
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0 || std::size_t(st.st_size) < sizeof(Header))
+    {
+        std::cout << "Error! Shared memory \"" << name << "\" is no signal table" << std::endl;
+        close(fd);
+        return nullptr;
+    }
+    std::size_t size = std::size_t(st.st_size);
+    void* memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        std::cout << "Error! Couldn't map shared memory \"" << name << "\": " << std::strerror(errno) << std::endl;
+        return nullptr;
+    }
+    if (!SharedSignalTableImpl::validate(memory, size))
+    {
+        std::cout << "Error! Shared memory \"" << name << "\" is no signal table of version " << version << std::endl;
+        munmap(memory, size);
+        return nullptr;
+    }
+    return std::make_unique<SharedSignalTableImpl>(std::string(name), memory, size, nullptr);
+}
+
+std::size_t SharedSignalTableImpl::layoutSize(const Network& network)
+{
+    return std::size_t(layout(network).size);
+}
+void SharedSignalTableImpl::initialize(void* memory, const Network& network)
+{
+    Layout l = layout(network);
+    uint8_t* bytes = static_cast<uint8_t*>(memory);
+    Header* header = new (bytes) Header();
+    MessageEntry* messages = reinterpret_cast<MessageEntry*>(bytes + l.messages_offset);
+    SignalEntry* signals = reinterpret_cast<SignalEntry*>(bytes + l.signals_offset);
+    SeqLockValue* values = reinterpret_cast<SeqLockValue*>(bytes + l.values_offset);
+    char* names = reinterpret_cast<char*>(bytes + l.names_offset);
+    for (uint64_t i = 0; i < l.n_signals; i++)
+    {
+        new (&signals[i]) SignalEntry();
+        new (&values[i]) SeqLockValue();
+    }
+    LayoutHash hash;
+    uint64_t name_offset = 0;
+    auto add_name = [&](const std::string& name)
+    {
+        std::memcpy(names + name_offset, name.c_str(), name.size() + 1);
+        uint64_t result = name_offset;
+        name_offset += name.size() + 1;
+        return result;
+    };
+    uint32_t index = 0;
+    network.forEachMessage(
+        [&](const Message& msg)
+        {
+            MessageEntry* entry = new (&messages[index]) MessageEntry();
+            entry->id = msg.getId();
+            entry->first_signal = msg.signalCount() ? uint32_t(msg.getSignalByIndex(0)->getGlobalIndex()) : 0;
+            entry->n_signals = uint32_t(msg.signalCount());
+            entry->name_offset = add_name(msg.getName());
+            hash.add(msg.getId());
+            hash.add(msg.getName());
+            hash.add(uint64_t(msg.signalCount()));
+            for (const Signal& sig : msg.signals())
+            {
+                SignalEntry& sig_entry = signals[sig.getGlobalIndex()];
+                sig_entry.message = index;
+                sig_entry.name_offset = add_name(sig.getName());
+                hash.add(sig.getName());
+                hash.add(uint64_t(sig.getMultiplexerIndicator()));
+                hash.add(sig.getMultiplexerSwitchValue());
+                hash.add(sig.getStartBit());
+                hash.add(sig.getBitSize());
+                hash.add(uint64_t(sig.getByteOrder()));
+                hash.add(uint64_t(sig.getValueType()));
+                hash.add(uint64_t(sig.getExtendedValueType()));
+                hash.add(sig.getFactor());
+                hash.add(sig.getOffset());
+            }
+            index++;
+        });
+    header->version = version;
+    header->size = l.size;
+    header->layout_hash = hash.get();
+    header->n_messages = uint32_t(l.n_messages);
+    header->n_signals = uint32_t(l.n_signals);
+    header->messages_offset = l.messages_offset;
+    header->signals_offset = l.signals_offset;
+    header->values_offset = l.values_offset;
+    header->names_offset = l.names_offset;
+    header->writer_alive.store(1, std::memory_order_relaxed);
+    header->magic.store(magic, std::memory_order_release);
+}
+bool SharedSignalTableImpl::validate(const void* memory, std::size_t size)
+{
+    const Header* header = static_cast<const Header*>(memory);
+    if (size < sizeof(Header) ||
+        header->magic.load(std::memory_order_acquire) != magic ||
+        header->version != version ||
+        header->size != size)
+    {
+        return false;
+    }
+    uint64_t n_messages = header->n_messages;
+    uint64_t n_signals = header->n_signals;
+    if (header->messages_offset + n_messages * sizeof(MessageEntry) > size ||
+        header->signals_offset + n_signals * sizeof(SignalEntry) > size ||
+        header->values_offset + n_signals * sizeof(SeqLockValue) > size ||
+        header->names_offset > size ||
+        header->messages_offset % alignof(MessageEntry) != 0 ||
+        header->signals_offset % alignof(SignalEntry) != 0 ||
+        header->values_offset % alignof(SeqLockValue) != 0)
+    {
+        return false;
+    }
+    // every name has to end within the segment
+    const uint8_t* bytes = static_cast<const uint8_t*>(memory);
+    uint64_t names_size = size - header->names_offset;
+    if (names_size != 0 && bytes[size - 1] != 0)
+    {
+        return false;
+    }
+    const MessageEntry* messages = reinterpret_cast<const MessageEntry*>(bytes + header->messages_offset);
+    const SignalEntry* signals = reinterpret_cast<const SignalEntry*>(bytes + header->signals_offset);
+    for (uint64_t i = 0; i < n_messages; i++)
+    {
+        if (messages[i].name_offset >= names_size ||
+            uint64_t(messages[i].first_signal) + messages[i].n_signals > n_signals)
+        {
+            return false;
+        }
+    }
+    for (uint64_t i = 0; i < n_signals; i++)
+    {
+        if (signals[i].name_offset >= names_size || signals[i].message >= n_messages)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+SharedSignalTableImpl::SharedSignalTableImpl(std::string&& name, void* memory, std::size_t size, const Network* network)
+    : _name(std::move(name))
+    , _memory(static_cast<uint8_t*>(memory))
+    , _size(size)
+    , _network(network)
+{
+    _header = reinterpret_cast<Header*>(_memory);
+    _messages = reinterpret_cast<MessageEntry*>(_memory + _header->messages_offset);
+    _signals = reinterpret_cast<SignalEntry*>(_memory + _header->signals_offset);
+    _values = reinterpret_cast<SeqLockValue*>(_memory + _header->values_offset);
+    _names = reinterpret_cast<const char*>(_memory + _header->names_offset);
+}
+SharedSignalTableImpl::~SharedSignalTableImpl()
+{
+    if (_network)
+    {
+        _header->writer_alive.store(0, std::memory_order_release);
+        shm_unlink(_name.c_str());
+    }
+    munmap(_memory, _size);
+}
+const std::string& SharedSignalTableImpl::getName() const
+{
+    return _name;
+}
+bool SharedSignalTableImpl::isWriter() const
+{
+    return _network != nullptr;
+}
+bool SharedSignalTableImpl::isWriterAlive() const
+{
+    return _header->writer_alive.load(std::memory_order_acquire) != 0;
+}
+uint64_t SharedSignalTableImpl::getLayoutHash() const
+{
+    return _header->layout_hash;
+}
+std::size_t SharedSignalTableImpl::messageCount() const
+{
+    return _header->n_messages;
+}
+uint64_t SharedSignalTableImpl::getMessageId(std::size_t message) const
+{
+    return _messages[message].id;
+}
+const char* SharedSignalTableImpl::getMessageName(std::size_t message) const
+{
+    return _names + _messages[message].name_offset;
+}
+std::size_t SharedSignalTableImpl::getFirstSignal(std::size_t message) const
+{
+    return _messages[message].first_signal;
+}
+std::size_t SharedSignalTableImpl::getMessageSignalCount(std::size_t message) const
+{
+    return _messages[message].n_signals;
+}
+std::size_t SharedSignalTableImpl::signalCount() const
+{
+    return _header->n_signals;
+}
+const char* SharedSignalTableImpl::getSignalName(std::size_t signal) const
+{
+    return _names + _signals[signal].name_offset;
+}
+std::size_t SharedSignalTableImpl::getSignalMessage(std::size_t signal) const
+{
+    return _signals[signal].message;
+}
+std::size_t SharedSignalTableImpl::findMessage(uint64_t id) const
+{
+    for (std::size_t i = 0; i < messageCount(); i++)
+    {
+        if (_messages[i].id == id)
+        {
+            return i;
+        }
+    }
+    return npos;
+}
+std::size_t SharedSignalTableImpl::findSignal(const std::string& message_name, const std::string& signal_name) const
+{
+    for (std::size_t i = 0; i < messageCount(); i++)
+    {
+        if (message_name != getMessageName(i))
+        {
+            continue;
+        }
+        for (std::size_t j = getFirstSignal(i); j < getFirstSignal(i) + getMessageSignalCount(i); j++)
+        {
+            if (signal_name == getSignalName(j))
+            {
+                return j;
+            }
+        }
+    }
+    return npos;
+}
+void SharedSignalTableImpl::update(const Message& msg, const void* bytes, uint64_t timestamp)
+{
+    std::size_t n = msg.signalCount();
+    if (!_network || n == 0)
+    {
+        return;
+    }
+    std::size_t first = msg.getSignalByIndex(0)->getGlobalIndex();
+    if (first + n > signalCount())
+    {
+        return;
+    }
+    std::atomic<uint64_t>& sequence = _messages[_signals[first].message].sequence;
+    uint64_t seq;
+    uint64_t update = seqlock_write_begin(sequence, seq);
+    seqlock_store_message(msg, bytes, timestamp, &_values[first], update);
+    seqlock_write_end(sequence, seq);
+}
+bool SharedSignalTableImpl::update(const Frame& frame)
+{
+    const Message* msg = _network ? _network->getMessageById(frame.id) : nullptr;
+    if (!msg)
+    {
+        return false;
+    }
+    update(*msg, frame.data, frame.timestamp);
+    return true;
+}
+uint64_t SharedSignalTableImpl::snapshot(std::size_t message, Value* values) const
+{
+    if (message >= messageCount())
+    {
+        return 0;
+    }
+    const MessageEntry& entry = _messages[message];
+    return seqlock_read(entry.sequence,
+        [&]
+        {
+            for (std::size_t i = 0; i < entry.n_signals; i++)
+            {
+                seqlock_load(_values[entry.first_signal + i], values[i]);
+            }
+        });
+}
+uint64_t SharedSignalTableImpl::load(std::size_t signal, Value& value) const
+{
+    if (signal >= signalCount())
+    {
+        value = Value{};
+        return 0;
+    }
+    return seqlock_read(_messages[_signals[signal].message].sequence,
+        [&]
+        {
+            seqlock_load(_values[signal], value);
+        });
+}
+#else
+std::unique_ptr<SharedSignalTable> SharedSignalTable::create(const std::string& name, const Network& network)
+{
+    std::cout << "Error! SharedSignalTable is only supported on POSIX systems" << std::endl;
+    return nullptr;
+}
+std::unique_ptr<SharedSignalTable> SharedSignalTable::open(const std::string& name)
+{
+    std::cout << "Error! SharedSignalTable is only supported on POSIX systems" << std::endl;
+    return nullptr;
+}
+#endif
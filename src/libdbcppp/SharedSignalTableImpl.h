@@ -0,0 +1,102 @@
+
+#pragma once
+
+#include <vector>
+
+#include "../../include/dbcppp/SharedSignalTable.h"
+#include "SeqLock.h"
+
+namespace dbcppp
+{
+    // the layout of the shared memory segment, every change of it has to increment version
+    namespace shared_layout
+    {
+        // "DBCS"
+        constexpr uint32_t magic = 0x53434244;
+        constexpr uint32_t version = 1;
+
+        struct alignas(64) Header
+        {
+            // written last, readers don't see a half initialized segment
+            std::atomic<uint32_t> magic;
+            uint32_t version;
+            uint64_t size;
+            uint64_t layout_hash;
+            uint32_t n_messages;
+            uint32_t n_signals;
+            uint64_t messages_offset;
+            uint64_t signals_offset;
+            uint64_t values_offset;
+            uint64_t names_offset;
+            std::atomic<uint32_t> writer_alive;
+        };
+        // one cache line per message, so writers of different messages don't share lines
+        struct alignas(64) MessageEntry
+        {
+            std::atomic<uint64_t> sequence;
+            uint64_t id;
+            uint32_t first_signal;
+            uint32_t n_signals;
+            // relative to Header::names_offset
+            uint64_t name_offset;
+        };
+        struct SignalEntry
+        {
+            uint32_t message;
+            uint32_t reserved;
+            uint64_t name_offset;
+        };
+        static_assert(sizeof(Header) == 128, "the layout must not change");
+        static_assert(sizeof(MessageEntry) == 64, "the layout must not change");
+        static_assert(sizeof(SignalEntry) == 16, "the layout must not change");
+        static_assert(std::atomic<uint32_t>::is_always_lock_free, "the header needs lock free 32 bit atomics");
+    }
+
+    class SharedSignalTableImpl final
+        : public SharedSignalTable
+    {
+    public:
+        // network is nullptr for readers
+        SharedSignalTableImpl(std::string&& name, void* memory, std::size_t size, const Network* network);
+        SharedSignalTableImpl(const SharedSignalTableImpl&) = delete;
+        SharedSignalTableImpl& operator=(const SharedSignalTableImpl&) = delete;
+        virtual ~SharedSignalTableImpl();
+
+        virtual const std::string& getName() const override;
+        virtual bool isWriter() const override;
+        virtual bool isWriterAlive() const override;
+        virtual uint64_t getLayoutHash() const override;
+        virtual std::size_t messageCount() const override;
+        virtual uint64_t getMessageId(std::size_t message) const override;
+        virtual const char* getMessageName(std::size_t message) const override;
+        virtual std::size_t getFirstSignal(std::size_t message) const override;
+        virtual std::size_t getMessageSignalCount(std::size_t message) const override;
+        virtual std::size_t signalCount() const override;
+        virtual const char* getSignalName(std::size_t signal) const override;
+        virtual std::size_t getSignalMessage(std::size_t signal) const override;
+        virtual std::size_t findMessage(uint64_t id) const override;
+        virtual std::size_t findSignal(const std::string& message_name, const std::string& signal_name) const override;
+        virtual void update(const Message& msg, const void* bytes, uint64_t timestamp) override;
+        virtual bool update(const Frame& frame) override;
+        virtual uint64_t snapshot(std::size_t message, Value* values) const override;
+        virtual uint64_t load(std::size_t signal, Value& value) const override;
+
+        // size of the segment for network
+        static std::size_t layoutSize(const Network& network);
+        // writes the layout of network into the zeroed memory of layoutSize bytes
+        static void initialize(void* memory, const Network& network);
+        // checks the header and the offsets of a segment of size bytes
+        static bool validate(const void* memory, std::size_t size);
+
+    private:
+        std::string _name;
+        uint8_t* _memory;
+        std::size_t _size;
+        const Network* _network;
+        shared_layout::Header* _header;
+        shared_layout::MessageEntry* _messages;
+        shared_layout::SignalEntry* _signals;
+        SeqLockValue* _values;
+        const char* _names;
+    };
+}
@@ -1,17 +1,16 @@
 
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
 #include <limits>
+#include <type_traits>
 #include <boost/endian/conversion.hpp>
 #include "SignalImpl.h"
 
 using namespace dbcppp;
 
-enum class Alignment
-{
-    size_inbetween_first_64_bit,
-    signal_exceeds_64_bit_size_but_signal_fits_into_64_bit,
-    signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit
-};
-
 template <Alignment aAlignment, Signal::ByteOrder aByteOrder, Signal::ValueType aValueType, Signal::ExtendedValueType aExtendedValueType>
 Signal::raw_t template_decode(const Signal* sig, const void* nbytes) noexcept
 {
@@ -260,6 +259,139 @@ double raw_to_phys(const Signal* sig, Signal::raw_t raw) noexcept
     return draw * sigi->getFactor() + sigi->getOffset();
 }
 template <class T>
+float raw_to_phys_float(const Signal* sig, Signal::raw_t raw) noexcept
+{
+    return float(raw_to_phys<T>(sig, raw));
+}
+// a float signal with factor 1 and offset 0, going through double would turn -0 into +0 and quiet signaling NaNs
+float raw_to_phys_float_unscaled(const Signal* sig, Signal::raw_t raw) noexcept
+{
+    uint32_t bits = uint32_t(raw);
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+template <class T>
+double raw_to_phys_table(const Signal* sig, Signal::raw_t raw) noexcept
+{
+    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+    uint64_t i = raw + sigi->_phys_table_bias;
+    if (i < sigi->_phys_table_size)
+    {
+        return sigi->_phys_table[i];
+    }
+    return raw_to_phys<T>(sig, raw);
+}
+constexpr int64_t pow10[] =
+{
+    1ll, 10ll, 100ll, 1000ll, 10000ll, 100000ll, 1000000ll, 10000000ll, 100000000ll, 1000000000ll,
+    10000000000ll, 100000000000ll, 1000000000000ll, 10000000000000ll, 100000000000000ll,
+    1000000000000000ll, 10000000000000000ll, 100000000000000000ll, 1000000000000000000ll
+};
+// result = a * b + c, false if it overflows
+bool checked_mul_add(int64_t a, int64_t b, int64_t c, int64_t& result) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    int64_t p;
+    return !__builtin_mul_overflow(a, b, &p) && !__builtin_add_overflow(p, c, &result);
+#else
+    constexpr int64_t max = std::numeric_limits<int64_t>::max();
+    constexpr int64_t min = std::numeric_limits<int64_t>::min();
+    if (a > 0 ? (b > 0 ? a > max / b : b < min / a) : (b > 0 ? a < min / b : a != 0 && b < max / a))
+    {
+        return false;
+    }
+    int64_t p = a * b;
+    if (c > 0 ? p > max - c : p < min - c)
+    {
+        return false;
+    }
+    result = p + c;
+    return true;
+#endif
+}
+// d as mantissa * 10^-scale from the shortest decimal representation which reads back as d, which is how d was
+// written in the DBC, more than 15 significant digits aren't a decimal fraction but a binary one like 1/3
+bool to_decimal(double d, int64_t& mantissa, int32_t& scale) noexcept
+{
+    if (!std::isfinite(d))
+    {
+        return false;
+    }
+    char buf[32];
+    int precision = 1;
+    for (; precision <= 15; precision++)
+    {
+        std::snprintf(buf, sizeof(buf), "%.*e", precision - 1, d);
+        if (std::strtod(buf, nullptr) == d)
+        {
+            break;
+        }
+    }
+    if (precision > 15)
+    {
+        return false;
+    }
+    // buf is [-]d.ddde[+-]xx, the decimal point depends on the locale
+    const char* c = buf;
+    bool negative = *c == '-';
+    int32_t digits = 0;
+    mantissa = 0;
+    for (; *c != 'e'; c++)
+    {
+        if (*c >= '0' && *c <= '9')
+        {
+            mantissa = mantissa * 10 + (*c - '0');
+            digits++;
+        }
+    }
+    scale = digits - 1 - int32_t(std::strtol(c + 1, nullptr, 10));
+    for (; scale < 0; scale++)
+    {
+        if (!checked_mul_add(mantissa, 10, 0, mantissa))
+        {
+            return false;
+        }
+    }
+    mantissa = negative ? -mantissa : mantissa;
+    return scale <= 18;
+}
+// factor and offset as integers with a common scale
+bool decimal_scale(double factor, double offset, int64_t& decimal_factor, int64_t& decimal_offset, int32_t& scale) noexcept
+{
+    int64_t f, o;
+    int32_t factor_scale, offset_scale;
+    if (!to_decimal(factor, f, factor_scale) || !to_decimal(offset, o, offset_scale))
+    {
+        return false;
+    }
+    scale = std::max(factor_scale, offset_scale);
+    return checked_mul_add(f, pow10[scale - factor_scale], 0, decimal_factor) &&
+        checked_mul_add(o, pow10[scale - offset_scale], 0, decimal_offset);
+}
+template <class T>
+bool raw_to_decimal(const Signal* sig, Signal::raw_t raw, int64_t* mantissa) noexcept
+{
+    const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
+    if constexpr (std::is_unsigned_v<T>)
+    {
+        if (raw > uint64_t(std::numeric_limits<int64_t>::max()))
+        {
+            return false;
+        }
+    }
+    return checked_mul_add(int64_t(raw), sigi->_decimal_factor, sigi->_decimal_offset, *mantissa);
+}
+bool no_raw_to_decimal(const Signal*, Signal::raw_t, int64_t*) noexcept
+{
+    return false;
+}
+template <class T>
+float raw_to_phys_table_float(const Signal* sig, Signal::raw_t raw) noexcept
+{
+    return float(raw_to_phys_table<T>(sig, raw));
+}
+template <class T>
 Signal::raw_t phys_to_raw(const Signal* sig, double phys) noexcept
 {
     const SignalImpl* sigi = static_cast<const SignalImpl*>(sig);
@@ -293,11 +425,6 @@ std::unique_ptr<Signal> Signal::create(
         avs.insert(std::make_pair(av.first, std::move(*static_cast<AttributeImpl*>(av.second.get()))));
         av.second.reset(nullptr);
     }
-    tsl::robin_map<int64_t, std::string> vds;
-    for (auto&& vd : value_descriptions)
-    {
-        vds.insert(std::move(vd));
-    }
     result = std::make_unique<SignalImpl>(
           message_size
         , std::move(name)
@@ -314,7 +441,7 @@ std::unique_ptr<Signal> Signal::create(
         , std::move(unit)
         , std::move(receivers)
         , std::move(avs)
-        , std::move(vds)
+        , ValueDescriptions::intern(std::move(value_descriptions))
         , std::move(comment)
         , extended_value_type);
     return result;
@@ -335,7 +462,7 @@ SignalImpl::SignalImpl(
     , std::string&& unit
     , std::set<std::string>&& receivers
     , std::map<std::string, AttributeImpl>&& attribute_values
-    , tsl::robin_map<int64_t, std::string>&& value_descriptions
+    , std::shared_ptr<const ValueDescriptions> value_descriptions
     , std::string&& comment
     , ExtendedValueType extended_value_type)
     
@@ -356,6 +483,15 @@ SignalImpl::SignalImpl(
     , _value_descriptions(std::move(value_descriptions))
     , _comment(std::move(comment))
     , _extended_value_type(std::move(extended_value_type))
+    , _index(0)
+    , _global_index(0)
+    , _parent(nullptr)
+    , _phys_table(nullptr)
+    , _phys_table_bias(0)
+    , _phys_table_size(0)
+    , _decimal_factor(0)
+    , _decimal_offset(0)
+    , _decimal_scale(-1)
     , _error(Signal::ErrorCode::NoError)
 {
     message_size = message_size < 8 ? 8 : message_size;
@@ -416,12 +552,12 @@ SignalImpl::SignalImpl(
     {
         nbytes = (_bit_size + (7 - _start_bit % 8) + 7) / 8;
     }
-    Alignment alignment = Alignment::size_inbetween_first_64_bit;
+    _alignment = Alignment::size_inbetween_first_64_bit;
     // check whether the data is in the first 8 bytes
     // so we can optimize out one memory access
     if (_byte_pos + nbytes <= 8)
     {
-        alignment = Alignment::size_inbetween_first_64_bit;
+        _alignment = Alignment::size_inbetween_first_64_bit;
         if (_byte_order == ByteOrder::LittleEndian)
         {
             _fixed_start_bit_0 = _start_bit;
@@ -434,7 +570,7 @@ SignalImpl::SignalImpl(
     // check whether we can align the data on 64 bit
     else if (_byte_pos  % 8 + nbytes <= 8)
     {
-        alignment = Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit;
+        _alignment = Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit;
         // align the byte pos on 64 bit
         _byte_pos -= _byte_pos % 8;
         _fixed_start_bit_0 = _start_bit - _byte_pos * 8;
@@ -446,7 +582,7 @@ SignalImpl::SignalImpl(
     // we aren't able to align the data on 64 bit, so check whether the data fits into on uint64_t
     else if (nbytes <= 8)
     {
-        alignment = Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit;
+        _alignment = Alignment::signal_exceeds_64_bit_size_but_signal_fits_into_64_bit;
         _fixed_start_bit_0 = _start_bit - _byte_pos * 8;
         if (_byte_order == ByteOrder::BigEndian)
         {
@@ -457,7 +593,7 @@ SignalImpl::SignalImpl(
     // so we have to compose the resulting value
     else
     {
-        alignment = Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit;
+        _alignment = Alignment::signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit;
         if (_byte_order == ByteOrder::BigEndian)
         {
             uint64_t nbits_last_byte = (7 - _start_bit % 8) + _bit_size - 64;
@@ -474,7 +610,7 @@ SignalImpl::SignalImpl(
         }
     }
 
-    _decode = ::make_decode(alignment, _byte_order, _value_type, _extended_value_type);
+    _decode = ::make_decode(_alignment, _byte_order, _value_type, _extended_value_type);
     _encode = ::encode;
     switch (_extended_value_type)
     {
@@ -483,21 +619,41 @@ SignalImpl::SignalImpl(
         {
         case Signal::ValueType::Signed:
             _raw_to_phys = ::raw_to_phys<int64_t>;
+            _raw_to_phys_float = ::raw_to_phys_float<int64_t>;
             _phys_to_raw = ::phys_to_raw<int64_t>;
+            _raw_to_decimal = ::raw_to_decimal<int64_t>;
             break;
         case Signal::ValueType::Unsigned:
             _raw_to_phys = ::raw_to_phys<uint64_t>;
+            _raw_to_phys_float = ::raw_to_phys_float<uint64_t>;
             _phys_to_raw = ::phys_to_raw<uint64_t>;
+            _raw_to_decimal = ::raw_to_decimal<uint64_t>;
             break;
         }
+        if (!::decimal_scale(_factor, _offset, _decimal_factor, _decimal_offset, _decimal_scale))
+        {
+            _decimal_scale = -1;
+            _raw_to_decimal = ::no_raw_to_decimal;
+        }
         break;
     case Signal::ExtendedValueType::Float:
         _raw_to_phys = ::raw_to_phys<float>;
+        if (_factor == 1. && _offset == 0.)
+        {
+            _raw_to_phys_float = ::raw_to_phys_float_unscaled;
+        }
+        else
+        {
+            _raw_to_phys_float = ::raw_to_phys_float<float>;
+        }
         _phys_to_raw = ::phys_to_raw<float>;
+        _raw_to_decimal = ::no_raw_to_decimal;
         break;
     case Signal::ExtendedValueType::Double:
         _raw_to_phys = ::raw_to_phys<double>;
+        _raw_to_phys_float = ::raw_to_phys_float<double>;
         _phys_to_raw = ::phys_to_raw<double>;
+        _raw_to_decimal = ::no_raw_to_decimal;
         break;
     }
 }
@@ -555,50 +711,50 @@ std::string SignalImpl::getUnit() const
 }
 bool SignalImpl::hasReceiver(const std::string& name) const
 {
-    return _receivers.find(name) != _receivers.end();
+    return _receivers.contains(name);
 }
 void SignalImpl::forEachReceiver(std::function<void(const std::string&)>&& cb) const
 {
-    for (const auto& n : _receivers)
+    for (const auto* n : _receivers)
     {
-        cb(n);
+        cb(*n);
     }
 }
 const std::string* SignalImpl::getValueDescriptionByValue(int64_t value) const
 {
-    const std::string* result = nullptr;
-    auto iter = _value_descriptions.find(value);
-    if (iter != _value_descriptions.end())
-    {
-        result = &iter->second;
-    }
-    return result;
+    return _value_descriptions->find(value);
 }
 void SignalImpl::forEachValueDescription(std::function<void(int64_t, const std::string&)>&& cb) const
 {
-    for (auto& av : _value_descriptions)
+    for (auto& av : _value_descriptions->descriptions())
     {
         cb(av.first, av.second);
     }
 }
+void SignalImpl::getValueDescriptionIds(const uint64_t* raws, std::size_t n, uint32_t* ids) const
+{
+    _value_descriptions->findIds(raws, n, ids);
+}
+const std::string* SignalImpl::getValueDescriptionById(uint32_t id) const
+{
+    return _value_descriptions->get(id);
+}
+std::size_t SignalImpl::valueDescriptionCount() const
+{
+    return _value_descriptions->size();
+}
 const Attribute* SignalImpl::getAttributeValueByName(const std::string& name) const
 {
-    const Attribute* result = nullptr;
-    auto iter = _attribute_values.find(name);
-    if (iter != _attribute_values.end())
-    {
-        result = &iter->second;
-    }
-    return result;
+    return _attribute_values.find(name);
 }
 const Attribute* SignalImpl::findAttributeValue(std::function<bool(const Attribute&)>&& pred) const
 {
     const Attribute* result = nullptr;
     for (const auto& av : _attribute_values)
     {
-        if (pred(av.second))
+        if (pred(av))
         {
-            result = &av.second;
+            result = &av;
             break;
         }
     }
@@ -608,7 +764,7 @@ const void SignalImpl::forEachAttributeValue(std::function<void(const Attribute&
 {
     for (const auto& av : _attribute_values)
     {
-        cb(av.second);
+        cb(av);
     }
 }
 const std::string& SignalImpl::getComment() const
@@ -619,6 +775,81 @@ Signal::ExtendedValueType SignalImpl::getExtendedValueType() const
 {
     return _extended_value_type;
 }
+std::size_t SignalImpl::getIndex() const
+{
+    return _index;
+}
+std::size_t SignalImpl::getGlobalIndex() const
+{
+    return _global_index;
+}
+int32_t SignalImpl::getDecimalScale() const
+{
+    return _decimal_scale;
+}
+bool Signal::rawToDecimal(raw_t raw, int32_t scale, int64_t& mantissa) const noexcept
+{
+    int32_t native_scale = getDecimalScale();
+    int64_t native;
+    if (native_scale < 0 || scale < native_scale || scale - native_scale > 18 || !rawToDecimal(raw, native))
+    {
+        return false;
+    }
+    return checked_mul_add(native, pow10[scale - native_scale], 0, mantissa);
+}
+void SignalImpl::setIndex(std::size_t index)
+{
+    _index = index;
+}
+void SignalImpl::setGlobalIndex(std::size_t index)
+{
+    _global_index = index;
+}
+const Message* SignalImpl::getParent() const
+{
+    return _parent;
+}
+void SignalImpl::setParent(const Message* parent)
+{
+    _parent = parent;
+}
+std::shared_ptr<const std::vector<double>> SignalImpl::makePhysTable() const
+{
+    if (_extended_value_type != ExtendedValueType::Integer || _bit_size > 32)
+    {
+        return nullptr;
+    }
+    auto table = std::make_shared<std::vector<double>>(std::size_t(1) << _bit_size);
+    uint64_t first = _value_type == ValueType::Signed ? ~uint64_t(0) << (_bit_size - 1) : 0;
+    for (std::size_t i = 0; i < table->size(); i++)
+    {
+        (*table)[i] = _raw_to_phys(this, first + i);
+    }
+    return table;
+}
+void SignalImpl::setPhysTable(std::shared_ptr<const std::vector<double>> table)
+{
+    if (_extended_value_type != ExtendedValueType::Integer || _bit_size > 32 ||
+        !table || table->size() != std::size_t(1) << _bit_size)
+    {
+        return;
+    }
+    _phys_table_storage = std::move(table);
+    _phys_table = _phys_table_storage->data();
+    _phys_table_size = _phys_table_storage->size();
+    if (_value_type == ValueType::Signed)
+    {
+        _phys_table_bias = uint64_t(1) << (_bit_size - 1);
+        _raw_to_phys = ::raw_to_phys_table<int64_t>;
+        _raw_to_phys_float = ::raw_to_phys_table_float<int64_t>;
+    }
+    else
+    {
+        _phys_table_bias = 0;
+        _raw_to_phys = ::raw_to_phys_table<uint64_t>;
+        _raw_to_phys_float = ::raw_to_phys_table_float<uint64_t>;
+    }
+}
 bool SignalImpl::getError(ErrorCode code) const
 {
     return code == _error || (uint64_t(_error) & uint64_t(code));
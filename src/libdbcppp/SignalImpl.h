@@ -3,14 +3,24 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <robin-map/tsl/robin_map.h>
+#include "ValueDescriptions.h"
 #include "../../include/dbcppp/Signal.h"
 #include "../../include/dbcppp/Node.h"
+#include "../../include/dbcppp/Message.h"
 #include "AttributeImpl.h"
 
 namespace dbcppp
 {
+    enum class Alignment
+    {
+        size_inbetween_first_64_bit,
+        signal_exceeds_64_bit_size_but_signal_fits_into_64_bit,
+        signal_exceeds_64_bit_size_and_signal_does_not_fit_into_64_bit
+    };
+
     class SignalImpl final
         : public Signal
     {
@@ -31,7 +41,7 @@ namespace dbcppp
             , std::string&& unit
             , std::set<std::string>&& receivers
             , std::map<std::string, AttributeImpl>&& attribute_values
-            , tsl::robin_map<int64_t, std::string>&& value_descriptions
+            , std::shared_ptr<const ValueDescriptions> value_descriptions
             , std::string&& comment
             , Signal::ExtendedValueType extended_value_type);
             
@@ -53,12 +63,29 @@ namespace dbcppp
         virtual void forEachReceiver(std::function<void(const std::string&)>&& cb) const override;
         virtual const std::string* getValueDescriptionByValue(int64_t value) const override;
         virtual void forEachValueDescription(std::function<void(int64_t, const std::string&)>&& cb) const override;
+        virtual void getValueDescriptionIds(const uint64_t* raws, std::size_t n, uint32_t* ids) const override;
+        virtual const std::string* getValueDescriptionById(uint32_t id) const override;
+        virtual std::size_t valueDescriptionCount() const override;
         virtual const Attribute* getAttributeValueByName(const std::string& name) const override;
         virtual const Attribute* findAttributeValue(std::function<bool(const Attribute&)>&& pred) const override;
         virtual const void forEachAttributeValue(std::function<void(const Attribute&)>&& cb) const override;
         virtual const std::string& getComment() const override;
         virtual ExtendedValueType getExtendedValueType() const override;
         virtual bool getError(ErrorCode code) const override;
+        virtual std::size_t getIndex() const override;
+        virtual std::size_t getGlobalIndex() const override;
+        virtual int32_t getDecimalScale() const override;
+
+        void setIndex(std::size_t index);
+        void setGlobalIndex(std::size_t index);
+        // the message which contains the signal, kept up to date by MessageImpl
+        const Message* getParent() const;
+        void setParent(const Message* parent);
+        // the physical values of all raw values of an integer signal, ordered from the smallest raw value on,
+        // nullptr for float and double signals or signals wider than 32 bit
+        std::shared_ptr<const std::vector<double>> makePhysTable() const;
+        // rawToPhys loads the physical value from table, raw values outside of the signal's range are computed
+        void setPhysTable(std::shared_ptr<const std::vector<double>> table);
 
     private:
         void setError(ErrorCode code);
@@ -75,11 +102,15 @@ namespace dbcppp
         double _minimum;
         double _maximum;
         std::string _unit;
-        std::set<std::string> _receivers;
-        std::map<std::string, AttributeImpl> _attribute_values;
-        tsl::robin_map<int64_t, std::string> _value_descriptions;
+        InternedStringSet _receivers;
+        SortedByName<AttributeImpl> _attribute_values;
+        std::shared_ptr<const ValueDescriptions> _value_descriptions;
         std::string _comment;
         ExtendedValueType _extended_value_type;
+        std::size_t _index;
+        std::size_t _global_index;
+        const Message* _parent;
+        std::shared_ptr<const std::vector<double>> _phys_table_storage;
 
     public:
         // for performance
@@ -88,6 +119,15 @@ namespace dbcppp
         uint64_t _fixed_start_bit_0;
         uint64_t _fixed_start_bit_1;
         uint64_t _byte_pos;
+        Alignment _alignment;
+        // raw + _phys_table_bias is the index into _phys_table, the bias moves signed raw values to 0
+        const double* _phys_table;
+        uint64_t _phys_table_bias;
+        uint64_t _phys_table_size;
+        // phys = (raw * _decimal_factor + _decimal_offset) * 10^-_decimal_scale
+        int64_t _decimal_factor;
+        int64_t _decimal_offset;
+        int32_t _decimal_scale;
 
         Signal::ErrorCode _error;
     };
@@ -0,0 +1,95 @@
+
+#include "SignalStateStoreImpl.h"
+
+using namespace dbcppp;
+
+std::unique_ptr<SignalStateStore> SignalStateStore::create(const Network& network)
+{
+    return std::make_unique<SignalStateStoreImpl>(network);
+}
+
+SignalStateStoreImpl::SignalStateStoreImpl(const Network& network)
+    : _network(network)
+    , _n_signals(network.signalCount())
+    , _values(std::make_unique<SeqLockValue[]>(network.signalCount()))
+    , _sequence_indices(network.signalCount())
+{
+    std::size_t n_messages = 0;
+    network.forEachMessage(
+        [&](const Message& msg)
+        {
+            for (const Signal& sig : msg.signals())
+            {
+                _sequence_indices[sig.getGlobalIndex()] = n_messages;
+            }
+            n_messages++;
+        });
+    _sequences = std::make_unique<Sequence[]>(n_messages);
+}
+const Network& SignalStateStoreImpl::getNetwork() const
+{
+    return _network;
+}
+void SignalStateStoreImpl::update(const Message& msg, const void* bytes, uint64_t timestamp)
+{
+    std::size_t n = msg.signalCount();
+    if (n == 0)
+    {
+        return;
+    }
+    std::size_t first = msg.getSignalByIndex(0)->getGlobalIndex();
+    if (first + n > _n_signals)
+    {
+        return;
+    }
+    std::atomic<uint64_t>& sequence = _sequences[_sequence_indices[first]].value;
+    uint64_t seq;
+    uint64_t update = seqlock_write_begin(sequence, seq);
+    seqlock_store_message(msg, bytes, timestamp, &_values[first], update);
+    seqlock_write_end(sequence, seq);
+}
+bool SignalStateStoreImpl::update(const Frame& frame)
+{
+    const Message* msg = _network.getMessageById(frame.id);
+    if (!msg)
+    {
+        return false;
+    }
+    update(*msg, frame.data, frame.timestamp);
+    return true;
+}
+uint64_t SignalStateStoreImpl::snapshot(const Message& msg, Value* values) const
+{
+    std::size_t n = msg.signalCount();
+    if (n == 0)
+    {
+        return 0;
+    }
+    std::size_t first = msg.getSignalByIndex(0)->getGlobalIndex();
+    if (first + n > _n_signals)
+    {
+        return 0;
+    }
+    return seqlock_read(_sequences[_sequence_indices[first]].value,
+        [&]
+        {
+            for (std::size_t i = 0; i < n; i++)
+            {
+                seqlock_load(_values[first + i], values[i]);
+            }
+        });
+}
+uint64_t SignalStateStoreImpl::load(const Signal& sig, Value& value) const
+{
+    std::size_t index = sig.getGlobalIndex();
+    if (index >= _n_signals)
+    {
+        value = Value{};
+        return 0;
+    }
+    return seqlock_read(_sequences[_sequence_indices[index]].value,
+        [&]
+        {
+            seqlock_load(_values[index], value);
+        });
+}
@@ -0,0 +1,37 @@
+
+#pragma once
+
+#include <vector>
+
+#include "SeqLock.h"
+
+namespace dbcppp
+{
+    class SignalStateStoreImpl final
+        : public SignalStateStore
+    {
+    public:
+        SignalStateStoreImpl(const Network& network);
+
+        virtual const Network& getNetwork() const override;
+        virtual void update(const Message& msg, const void* bytes, uint64_t timestamp) override;
+        virtual bool update(const Frame& frame) override;
+        virtual uint64_t snapshot(const Message& msg, Value* values) const override;
+        virtual uint64_t load(const Signal& sig, Value& value) const override;
+
+    private:
+        // one cache line per message, so writers of different messages don't share lines
+        struct alignas(64) Sequence
+        {
+            // odd while a writer updates the message
+            std::atomic<uint64_t> value;
+        };
+
+        const Network& _network;
+        std::size_t _n_signals;
+        std::unique_ptr<SeqLockValue[]> _values;
+        std::unique_ptr<Sequence[]> _sequences;
+        // the index into _sequences by Signal::getGlobalIndex
+        std::vector<std::size_t> _sequence_indices;
+    };
+}
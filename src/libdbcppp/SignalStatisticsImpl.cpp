@@ -0,0 +1,151 @@
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "SignalStatisticsImpl.h"
+
+using namespace dbcppp;
+
+std::unique_ptr<SignalStatistics> SignalStatistics::create(const Network& network, uint64_t window, callback_t cb)
+{
+    return std::make_unique<SignalStatisticsImpl>(network, window == 0 ? 1 : window, std::move(cb));
+}
+
+SignalStatisticsImpl::SignalStatisticsImpl(const Network& network, uint64_t window, callback_t&& cb)
+    : _network(network)
+    , _window(window)
+    , _cb(std::move(cb))
+    , _window_index(0)
+    , _have_values(false)
+    , _shift(network.signalCount())
+    , _count(network.signalCount())
+    , _sum(network.signalCount())
+    , _sum_shifted(network.signalCount())
+    , _sum_sq_shifted(network.signalCount())
+    , _min(network.signalCount())
+    , _max(network.signalCount())
+    , _last(network.signalCount())
+    , _last_timestamp(network.signalCount())
+{
+    std::size_t max_signals = 0;
+    network.forEachMessage(
+        [&](const Message& msg)
+        {
+            if (msg.signalCount())
+            {
+                _messages.insert(std::make_pair(msg.getId(), std::make_pair(&msg, msg.getSignalByIndex(0)->getGlobalIndex())));
+                max_signals = std::max(max_signals, msg.signalCount());
+            }
+        });
+    _values.resize(max_signals);
+    _aggregates.reserve(network.signalCount());
+    reset();
+}
+uint64_t SignalStatisticsImpl::getWindow() const
+{
+    return _window;
+}
+void SignalStatisticsImpl::reset()
+{
+    std::fill(_count.begin(), _count.end(), 0.);
+    std::fill(_sum.begin(), _sum.end(), 0.);
+    std::fill(_sum_shifted.begin(), _sum_shifted.end(), 0.);
+    std::fill(_sum_sq_shifted.begin(), _sum_sq_shifted.end(), 0.);
+    std::fill(_min.begin(), _min.end(), std::numeric_limits<double>::infinity());
+    std::fill(_max.begin(), _max.end(), -std::numeric_limits<double>::infinity());
+    _have_values = false;
+}
+void SignalStatisticsImpl::flush()
+{
+    if (!_have_values)
+    {
+        return;
+    }
+    _aggregates.clear();
+    for (std::size_t i = 0; i < _count.size(); i++)
+    {
+        if (_count[i] == 0.)
+        {
+            continue;
+        }
+        double mean = _sum[i] / _count[i];
+        double mean_shifted = _sum_shifted[i] / _count[i];
+        double variance = std::max(_sum_sq_shifted[i] / _count[i] - mean_shifted * mean_shifted, 0.);
+        _aggregates.push_back(Aggregate{_network.getSignalByGlobalIndex(i), uint64_t(_count[i]),
+            _min[i], _max[i], mean, variance, _last[i], _last_timestamp[i]});
+    }
+    if (!_aggregates.empty())
+    {
+        _cb(_window_index * _window, &_aggregates[0], _aggregates.size());
+    }
+    reset();
+}
+void SignalStatisticsImpl::addMessage(const Message& msg, std::size_t first, const void* bytes, uint64_t timestamp)
+{
+    uint64_t window_index = timestamp / _window;
+    if (_have_values && window_index > _window_index)
+    {
+        flush();
+    }
+    if (!_have_values)
+    {
+        _window_index = window_index;
+        _have_values = true;
+    }
+    std::size_t n = msg.signalCount();
+    double* values = &_values[0];
+    // inactive multiplexed signals keep the NaN
+    std::fill(values, values + n, std::numeric_limits<double>::quiet_NaN());
+    msg.decodeAll(bytes, values);
+
+    double* shift = &_shift[first];
+    double* count = &_count[first];
+    double* sum = &_sum[first];
+    double* sum_shifted = &_sum_shifted[first];
+    double* sum_sq_shifted = &_sum_sq_shifted[first];
+    double* min = &_min[first];
+    double* max = &_max[first];
+    double* last = &_last[first];
+    uint64_t* last_timestamp = &_last_timestamp[first];
+    // branch free, so the compiler can vectorize it
+    for (std::size_t i = 0; i < n; i++)
+    {
+        double v = values[i];
+        bool valid = v == v;
+        double k = valid && count[i] == 0. ? v : shift[i];
+        double d = valid ? v - k : 0.;
+        shift[i] = k;
+        count[i] += valid ? 1. : 0.;
+        sum[i] += valid ? v : 0.;
+        sum_shifted[i] += d;
+        sum_sq_shifted[i] += d * d;
+        min[i] = valid && v < min[i] ? v : min[i];
+        max[i] = valid && v > max[i] ? v : max[i];
+        last[i] = valid ? v : last[i];
+        last_timestamp[i] = valid ? timestamp : last_timestamp[i];
+    }
+}
+void SignalStatisticsImpl::add(const Frame* frames, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; i++)
+    {
+        auto iter = _messages.find(frames[i].id);
+        if (iter != _messages.end())
+        {
+            addMessage(*iter->second.first, iter->second.second, frames[i].data, frames[i].timestamp);
+        }
+    }
+}
+void SignalStatisticsImpl::add(const Message& msg, const void* bytes, uint64_t timestamp)
+{
+    std::size_t n = msg.signalCount();
+    if (n == 0)
+    {
+        return;
+    }
+    std::size_t first = msg.getSignalByIndex(0)->getGlobalIndex();
+    if (first + n <= _count.size())
+    {
+        addMessage(msg, first, bytes, timestamp);
+    }
+}
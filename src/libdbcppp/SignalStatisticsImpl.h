@@ -0,0 +1,51 @@
+
+#pragma once
+
+#include <vector>
+#include <robin-map/tsl/robin_map.h>
+
+#include "../../include/dbcppp/SignalStatistics.h"
+
+namespace dbcppp
+{
+    class SignalStatisticsImpl final
+        : public SignalStatistics
+    {
+    public:
+        SignalStatisticsImpl(const Network& network, uint64_t window, callback_t&& cb);
+
+        virtual uint64_t getWindow() const override;
+        virtual void add(const Frame* frames, std::size_t n) override;
+        virtual void add(const Message& msg, const void* bytes, uint64_t timestamp) override;
+        virtual void flush() override;
+
+    private:
+        void addMessage(const Message& msg, std::size_t first, const void* bytes, uint64_t timestamp);
+        void reset();
+
+        const Network& _network;
+        uint64_t _window;
+        callback_t _cb;
+        // the global index of the first signal per message id
+        tsl::robin_map<uint64_t, std::pair<const Message*, std::size_t>> _messages;
+        // the current window, _window_index is valid if _have_values
+        uint64_t _window_index;
+        bool _have_values;
+
+        // structure of arrays by global index, the variance is computed from the values minus _shift,
+        // the first value of the window, so it doesn't suffer from cancellation
+        std::vector<double> _shift;
+        std::vector<double> _count;
+        std::vector<double> _sum;
+        std::vector<double> _sum_shifted;
+        std::vector<double> _sum_sq_shifted;
+        std::vector<double> _min;
+        std::vector<double> _max;
+        std::vector<double> _last;
+        std::vector<uint64_t> _last_timestamp;
+
+        // decodeAll output of one message
+        std::vector<double> _values;
+        std::vector<Aggregate> _aggregates;
+    };
+}
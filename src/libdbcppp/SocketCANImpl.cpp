@@ -0,0 +1,155 @@
+
+#include <iostream>
+#include <cstring>
+#include <cstddef>
+#include <cerrno>
+#include "SocketCANImpl.h"
+
+using namespace dbcppp;
+
+#ifdef __linux__
+#include <unistd.h>
+#include <net/if.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+
+static_assert(offsetof(Frame, id) == offsetof(canfd_frame, can_id), "Frame must be layout compatible with canfd_frame");
+static_assert(offsetof(Frame, size) == offsetof(canfd_frame, len), "Frame must be layout compatible with canfd_frame");
+static_assert(offsetof(Frame, data) == offsetof(canfd_frame, data), "Frame must be layout compatible with canfd_frame");
+
+std::unique_ptr<SocketCAN> SocketCAN::create(
+      const std::string& interface_name
+    , uint32_t bus
+    , std::size_t batch_size)
+{
+    std::unique_ptr<SocketCAN> result;
+    int fd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (fd < 0)
+    {
+        std::cout << "Error! Couldn't create CAN socket: " << std::strerror(errno) << std::endl;
+        return result;
+    }
+    int on = 1;
+    // CAN FD frames are optional, the kernel just keeps sending classic frames if it's not supported
+    setsockopt(fd, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &on, sizeof(on));
+    if (setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) < 0)
+    {
+        std::cout << "Warning: Kernel timestamps are not available for \"" << interface_name << "\"" << std::endl;
+    }
+    sockaddr_can addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.can_family = AF_CAN;
+    addr.can_ifindex = if_nametoindex(interface_name.c_str());
+    if (addr.can_ifindex == 0)
+    {
+        std::cout << "Error! Couldn't find CAN interface \"" << interface_name << "\"" << std::endl;
+        close(fd);
+        return result;
+    }
+    if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+    {
+        std::cout << "Error! Couldn't bind to \"" << interface_name << "\": " << std::strerror(errno) << std::endl;
+        close(fd);
+        return result;
+    }
+    result = std::make_unique<SocketCANImpl>(std::string(interface_name), fd, bus, batch_size == 0 ? 1 : batch_size);
+    return result;
+}
+
+SocketCANImpl::SocketCANImpl(
+      std::string&& interface_name
+    , int fd
+    , uint32_t bus
+    , std::size_t batch_size)
+
+    : _interface_name(std::move(interface_name))
+    , _fd(fd)
+    , _bus(bus)
+    , _msgs(batch_size)
+    , _iovecs(batch_size)
+    , _controls(batch_size * control_size)
+{}
+SocketCANImpl::~SocketCANImpl()
+{
+    close(_fd);
+}
+const std::string& SocketCANImpl::getInterfaceName() const
+{
+    return _interface_name;
+}
+int SocketCANImpl::getFileDescriptor() const
+{
+    return _fd;
+}
+std::size_t SocketCANImpl::receive(Frame* frames, std::size_t n)
+{
+    n = n < _msgs.size() ? n : _msgs.size();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        // let the kernel write the canfd_frame directly into the caller's frame
+        _iovecs[i].iov_base = &frames[i];
+        _iovecs[i].iov_len = sizeof(canfd_frame);
+        msghdr& hdr = _msgs[i].msg_hdr;
+        hdr.msg_name = nullptr;
+        hdr.msg_namelen = 0;
+        hdr.msg_iov = &_iovecs[i];
+        hdr.msg_iovlen = 1;
+        hdr.msg_control = &_controls[i * control_size];
+        hdr.msg_controllen = control_size;
+        hdr.msg_flags = 0;
+    }
+    int nmsgs = recvmmsg(_fd, &_msgs[0], unsigned(n), MSG_WAITFORONE, nullptr);
+    if (nmsgs <= 0)
+    {
+        return 0;
+    }
+    std::size_t result = 0;
+    for (int i = 0; i < nmsgs; i++)
+    {
+        Frame& frame = frames[result];
+        if (&frame != &frames[i])
+        {
+            std::memcpy(&frame, &frames[i], sizeof(canfd_frame));
+        }
+        if (frame.id & CAN_ERR_FLAG)
+        {
+            continue;
+        }
+        if (_msgs[i].msg_len == CAN_MTU)
+        {
+            frame.flags = 0;
+        }
+        if (frame.id & CAN_EFF_FLAG)
+        {
+            frame.id &= CAN_EFF_FLAG | CAN_EFF_MASK;
+        }
+        else
+        {
+            frame.id &= CAN_SFF_MASK;
+        }
+        frame.bus = _bus;
+        frame.timestamp = 0;
+        msghdr& hdr = _msgs[i].msg_hdr;
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr); cmsg; cmsg = CMSG_NXTHDR(&hdr, cmsg))
+        {
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS)
+            {
+                timespec ts;
+                std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+                frame.timestamp = uint64_t(ts.tv_sec) * 1000000000ull + uint64_t(ts.tv_nsec);
+            }
+        }
+        result++;
+    }
+    return result;
+}
+#else
+std::unique_ptr<SocketCAN> SocketCAN::create(
+      const std::string& interface_name
+    , uint32_t bus
+    , std::size_t batch_size)
+{
+    std::cout << "Error! SocketCAN is only supported on Linux" << std::endl;
+    return nullptr;
+}
+#endif
@@ -0,0 +1,43 @@
+
+#pragma once
+
+#include <vector>
+
+#include "../../include/dbcppp/SocketCAN.h"
+
+#ifdef __linux__
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <time.h>
+
+namespace dbcppp
+{
+    class SocketCANImpl final
+        : public SocketCAN
+    {
+    public:
+        SocketCANImpl(
+              std::string&& interface_name
+            , int fd
+            , uint32_t bus
+            , std::size_t batch_size);
+        SocketCANImpl(const SocketCANImpl&) = delete;
+        SocketCANImpl& operator=(const SocketCANImpl&) = delete;
+        virtual ~SocketCANImpl();
+
+        virtual const std::string& getInterfaceName() const override;
+        virtual int getFileDescriptor() const override;
+        virtual std::size_t receive(Frame* frames, std::size_t n) override;
+
+    private:
+        static constexpr std::size_t control_size = CMSG_SPACE(sizeof(timespec));
+
+        std::string _interface_name;
+        int _fd;
+        uint32_t _bus;
+        std::vector<mmsghdr> _msgs;
+        std::vector<iovec> _iovecs;
+        std::vector<char> _controls;
+    };
+}
+#endif
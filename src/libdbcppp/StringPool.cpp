@@ -0,0 +1,34 @@
+
+#include <mutex>
+#include <algorithm>
+#include <unordered_set>
+#include "StringPool.h"
+
+using namespace dbcppp;
+
+const std::string* StringPool::intern(const std::string& str)
+{
+    // node based, inserting doesn't move the strings already in the pool
+    static std::unordered_set<std::string> pool;
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    return &*pool.insert(str).first;
+}
+
+InternedStringSet::InternedStringSet(const std::set<std::string>& strs)
+{
+    _strs.reserve(strs.size());
+    for (const auto& str : strs)
+    {
+        _strs.push_back(StringPool::intern(str));
+    }
+}
+bool InternedStringSet::contains(const std::string& str) const
+{
+    auto iter = std::lower_bound(_strs.begin(), _strs.end(), str,
+        [](const std::string* lhs, const std::string& rhs)
+        {
+            return *lhs < rhs;
+        });
+    return iter != _strs.end() && **iter == str;
+}
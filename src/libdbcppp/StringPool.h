@@ -0,0 +1,76 @@
+
+#pragma once
+
+#include <set>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace dbcppp
+{
+    // node and attribute names repeat in every signal and message of a network, the pool stores each of them
+    // once, it only grows so the returned pointers stay valid for the lifetime of the program
+    class StringPool
+    {
+    public:
+        static const std::string* intern(const std::string& str);
+    };
+    // replaces std::set<std::string> for the small sets of node names, the interned strings are sorted by value
+    class InternedStringSet
+    {
+    public:
+        using const_iterator = std::vector<const std::string*>::const_iterator;
+
+        InternedStringSet() = default;
+        InternedStringSet(const std::set<std::string>& strs);
+
+        bool contains(const std::string& str) const;
+        const_iterator begin() const { return _strs.begin(); }
+        const_iterator end() const { return _strs.end(); }
+        std::size_t size() const { return _strs.size(); }
+
+    private:
+        std::vector<const std::string*> _strs;
+    };
+    // replaces std::map<std::string, T> for the attribute values of one object, the values are sorted by
+    // T::getName()
+    template <class T>
+    class SortedByName
+    {
+    public:
+        using const_iterator = typename std::vector<T>::const_iterator;
+
+        SortedByName() = default;
+        SortedByName(std::map<std::string, T>&& values)
+        {
+            _values.reserve(values.size());
+            for (auto& v : values)
+            {
+                _values.push_back(std::move(v.second));
+            }
+            // the keys of maps passed to the public create functions don't have to match the names
+            std::stable_sort(_values.begin(), _values.end(),
+                [](const T& lhs, const T& rhs)
+                {
+                    return lhs.getName() < rhs.getName();
+                });
+        }
+
+        const T* find(const std::string& name) const
+        {
+            auto iter = std::lower_bound(_values.begin(), _values.end(), name,
+                [](const T& lhs, const std::string& rhs)
+                {
+                    return lhs.getName() < rhs;
+                });
+            return iter != _values.end() && iter->getName() == name ? &*iter : nullptr;
+        }
+        const_iterator begin() const { return _values.begin(); }
+        const_iterator end() const { return _values.end(); }
+        std::size_t size() const { return _values.size(); }
+
+    private:
+        std::vector<T> _values;
+    };
+}
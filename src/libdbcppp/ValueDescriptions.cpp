@@ -0,0 +1,134 @@
+
+#include <mutex>
+#include <iterator>
+#include <algorithm>
+#include "ValueDescriptions.h"
+
+using namespace dbcppp;
+
+std::shared_ptr<const ValueDescriptions> ValueDescriptions::intern(std::unordered_map<int64_t, std::string>&& descs)
+{
+    // most signals don't have value descriptions at all
+    static const auto empty = std::make_shared<const ValueDescriptions>(std::vector<description_t>());
+    if (descs.empty())
+    {
+        return empty;
+    }
+    std::vector<description_t> sorted;
+    sorted.reserve(descs.size());
+    for (auto&& desc : descs)
+    {
+        sorted.emplace_back(desc.first, std::move(desc.second));
+    }
+    std::sort(sorted.begin(), sorted.end(),
+        [](const description_t& lhs, const description_t& rhs)
+        {
+            return lhs.first < rhs.first;
+        });
+    auto candidate = std::make_shared<const ValueDescriptions>(std::move(sorted));
+
+    // the pool doesn't keep the tables alive, expired entries are dropped whenever the pool doubled in size
+    static std::unordered_multimap<std::size_t, std::weak_ptr<const ValueDescriptions>> pool;
+    static std::size_t sweep_size = 64;
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto range = pool.equal_range(candidate->hash());
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        if (auto existing = iter->second.lock())
+        {
+            if (*existing == *candidate)
+            {
+                return existing;
+            }
+        }
+    }
+    if (pool.size() >= sweep_size)
+    {
+        for (auto iter = pool.begin(); iter != pool.end();)
+        {
+            iter = iter->second.expired() ? pool.erase(iter) : std::next(iter);
+        }
+        sweep_size = std::max<std::size_t>(64, 2 * pool.size());
+    }
+    pool.insert(std::make_pair(candidate->hash(), candidate));
+    return candidate;
+}
+ValueDescriptions::ValueDescriptions(std::vector<description_t>&& descs)
+    : _descs(std::move(descs))
+    , _kind(Kind::Sorted)
+    , _min(0)
+    , _hash(0)
+{
+    for (const auto& desc : _descs)
+    {
+        _hash = _hash * 31 + std::hash<int64_t>()(desc.first);
+        _hash = _hash * 31 + std::hash<std::string>()(desc.second);
+    }
+    if (_descs.empty())
+    {
+        return;
+    }
+    // 4 byte per slot, a range with up to 3 holes per description is still smaller than the hash map
+    _min = _descs.front().first;
+    uint64_t span = uint64_t(_descs.back().first) - uint64_t(_min);
+    if (span < 4 * _descs.size() + 16)
+    {
+        _kind = Kind::Dense;
+        _dense.resize(std::size_t(span) + 1, npos);
+        for (std::size_t i = 0; i < _descs.size(); i++)
+        {
+            _dense[std::size_t(uint64_t(_descs[i].first) - uint64_t(_min))] = uint32_t(i);
+        }
+    }
+    else if (_descs.size() > 16)
+    {
+        _kind = Kind::Hash;
+        _ids.reserve(_descs.size());
+        for (std::size_t i = 0; i < _descs.size(); i++)
+        {
+            _ids.insert(std::make_pair(_descs[i].first, uint32_t(i)));
+        }
+    }
+}
+void ValueDescriptions::findIds(const uint64_t* values, std::size_t n, uint32_t* ids) const
+{
+    if (_kind == Kind::Dense)
+    {
+        const uint32_t* dense = _dense.data();
+        uint64_t size = _dense.size();
+        uint64_t min = uint64_t(_min);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            uint64_t j = values[i] - min;
+            ids[i] = j < size ? dense[j] : npos;
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < n; i++)
+        {
+            ids[i] = findId(int64_t(values[i]));
+        }
+    }
+}
+const std::vector<ValueDescriptions::description_t>& ValueDescriptions::descriptions() const
+{
+    return _descs;
+}
+ValueDescriptions::Kind ValueDescriptions::getKind() const
+{
+    return _kind;
+}
+std::size_t ValueDescriptions::size() const
+{
+    return _descs.size();
+}
+std::size_t ValueDescriptions::hash() const
+{
+    return _hash;
+}
+bool dbcppp::operator==(const ValueDescriptions& lhs, const ValueDescriptions& rhs)
+{
+    return lhs.hash() == rhs.hash() && lhs.descriptions() == rhs.descriptions();
+}
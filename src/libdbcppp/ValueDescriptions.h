@@ -0,0 +1,101 @@
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+
+#include <robin-map/tsl/robin_map.h>
+
+namespace dbcppp
+{
+    // immutable value description table, the same enums (Off/On/Error/SNA, ...) are repeated in thousands of
+    // signals, intern() returns one shared instance for all equal tables
+    class ValueDescriptions
+    {
+    public:
+        using description_t = std::pair<int64_t, std::string>;
+        // the id of a description is its position in descriptions()
+        static constexpr uint32_t npos = 0xFFFFFFFF;
+        // picked when the table is built:
+        //   Dense: the values cover a compact range, the ids are an array indexed by value - min
+        //   Sorted: few sparse values, binary search in descriptions()
+        //   Hash: many sparse values
+        enum class Kind
+        {
+            Dense, Sorted, Hash
+        };
+
+        static std::shared_ptr<const ValueDescriptions> intern(std::unordered_map<int64_t, std::string>&& descs);
+
+        ValueDescriptions(std::vector<description_t>&& descs);
+
+        uint32_t findId(int64_t value) const
+        {
+            uint32_t result = npos;
+            switch (_kind)
+            {
+            case Kind::Dense:
+            {
+                uint64_t i = uint64_t(value) - uint64_t(_min);
+                if (i < _dense.size())
+                {
+                    result = _dense[i];
+                }
+                break;
+            }
+            case Kind::Sorted:
+            {
+                auto iter = std::lower_bound(_descs.begin(), _descs.end(), value,
+                    [](const description_t& lhs, int64_t rhs)
+                    {
+                        return lhs.first < rhs;
+                    });
+                if (iter != _descs.end() && iter->first == value)
+                {
+                    result = uint32_t(iter - _descs.begin());
+                }
+                break;
+            }
+            case Kind::Hash:
+            {
+                auto iter = _ids.find(value);
+                if (iter != _ids.end())
+                {
+                    result = iter->second;
+                }
+                break;
+            }
+            }
+            return result;
+        }
+        const std::string* find(int64_t value) const
+        {
+            return get(findId(value));
+        }
+        const std::string* get(uint32_t id) const
+        {
+            return id < _descs.size() ? &_descs[id].second : nullptr;
+        }
+        // findId for n values, the values are raw values as returned by Signal::decode
+        void findIds(const uint64_t* values, std::size_t n, uint32_t* ids) const;
+
+        // ordered by value
+        const std::vector<description_t>& descriptions() const;
+        Kind getKind() const;
+        std::size_t size() const;
+        std::size_t hash() const;
+
+    private:
+        std::vector<description_t> _descs;
+        Kind _kind;
+        int64_t _min;
+        std::vector<uint32_t> _dense;
+        tsl::robin_map<int64_t, uint32_t> _ids;
+        std::size_t _hash;
+    };
+    bool operator==(const ValueDescriptions& lhs, const ValueDescriptions& rhs);
+}
@@ -15,17 +15,13 @@ std::unique_ptr<ValueTable> ValueTable::create(
         st = std::move(static_cast<SignalTypeImpl&>(**signal_type));
         (*signal_type).reset(nullptr);
     }
-    tsl::robin_map<int64_t, std::string> veds;
-    for (auto&& ved : value_encoding_descriptions)
-    {
-        veds.insert(std::move(ved));
-    }
-    return std::make_unique<ValueTableImpl>(std::move(name), std::move(st), std::move(veds));
+    return std::make_unique<ValueTableImpl>(std::move(name), std::move(st),
+        ValueDescriptions::intern(std::move(value_encoding_descriptions)));
 }
 ValueTableImpl::ValueTableImpl(
       std::string&& name
     , boost::optional<SignalTypeImpl>&& signal_type
-    , tsl::robin_map<int64_t, std::string>&& value_encoding_descriptions)
+    , std::shared_ptr<const ValueDescriptions> value_encoding_descriptions)
 
     : _name(std::move(name))
     , _signal_type(std::move(signal_type))
@@ -49,17 +45,11 @@ boost::optional<const SignalType&> ValueTableImpl::getSignalType() const
 }
 const std::string* ValueTableImpl::getvalueEncodingDescriptionByValue(int64_t value) const
 {
-    const std::string* result = nullptr;
-    auto iter = _value_encoding_descriptions.find(value);
-    if (iter != _value_encoding_descriptions.end())
-    {
-        result = &iter->second;
-    }
-    return result;
+    return _value_encoding_descriptions->find(value);
 }
 void ValueTableImpl::forEachValueEncodingDescription(std::function<void(int64_t, const std::string&)>&& cb) const
 {
-    for (const auto& ved : _value_encoding_descriptions)
+    for (const auto& ved : _value_encoding_descriptions->descriptions())
     {
         cb(ved.first, ved.second);
     }
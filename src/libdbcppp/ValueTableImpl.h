@@ -5,6 +5,7 @@
 #include <memory>
 
 #include <robin-map/tsl/robin_map.h>
+#include "ValueDescriptions.h"
 #include "../../include/dbcppp/ValueTable.h"
 #include "SignalTypeImpl.h"
 
@@ -17,7 +18,7 @@ namespace dbcppp
         ValueTableImpl(
               std::string&& name
             , boost::optional<SignalTypeImpl>&& signal_type
-            , tsl::robin_map<int64_t, std::string>&& value_encoding_descriptions);
+            , std::shared_ptr<const ValueDescriptions> value_encoding_descriptions);
 
         virtual std::unique_ptr<ValueTable> clone() const override;
 
@@ -29,6 +30,6 @@ namespace dbcppp
     private:
         std::string _name;
         boost::optional<SignalTypeImpl> _signal_type;
-        tsl::robin_map<int64_t, std::string> _value_encoding_descriptions;
+        std::shared_ptr<const ValueDescriptions> _value_encoding_descriptions;
     };
 }